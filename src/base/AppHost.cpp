@@ -17,10 +17,55 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "AppHost.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <vector>
 #include "tgfx/core/Clock.h"
+#include "tgfx/core/Point.h"
 #include "tgfx/platform/Print.h"
 
 namespace benchmark {
+// The virtual frame time used in deterministic mode, matching a 60 fps display.
+static constexpr int64_t VIRTUAL_FRAME_TIME = 16667;
+// The periods of the built-in mouse path in frames, which differ so that it sweeps the screen.
+static constexpr float MOUSE_PERIOD_X = 420.f;
+static constexpr float MOUSE_PERIOD_Y = 270.f;
+
+static bool DeterministicFlag = false;
+static std::vector<tgfx::Point> MousePath = {};
+
+void AppHost::SetDeterministic(bool enabled) {
+  DeterministicFlag = enabled;
+}
+
+bool AppHost::IsDeterministic() {
+  return DeterministicFlag;
+}
+
+bool AppHost::LoadMousePath(const std::string& path) {
+  MousePath.clear();
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream stream(line);
+    float x = 0;
+    float y = 0;
+    if (stream >> x >> y) {
+      MousePath.push_back(tgfx::Point::Make(x, y));
+    }
+  }
+  if (MousePath.empty()) {
+    tgfx::PrintError("AppHost::LoadMousePath() no valid points in %s!", path.c_str());
+    return false;
+  }
+  return true;
+}
+
 AppHost::AppHost(int width, int height, float density)
     : _width(width), _height(height), _density(density) {
 }
@@ -91,6 +136,10 @@ void AppHost::addTypeface(const std::string& name, std::shared_ptr<tgfx::Typefac
   typefaces[name] = std::move(typeface);
 }
 
+int64_t AppHost::currentTime() const {
+  return IsDeterministic() ? virtualTime : tgfx::Clock::Now();
+}
+
 float AppHost::currentFPS() const {
   if (fpsTimeStamps.size() < 60) {
     return 0.0f;
@@ -110,7 +159,24 @@ int64_t AppHost::averageDrawTime() const {
   return total / static_cast<int64_t>(drawTimes.size());
 }
 
+int64_t AppHost::averageLatency() const {
+  if (latencies.empty()) {
+    return 0;
+  }
+  int64_t total = 0;
+  for (auto& latency : latencies) {
+    total += latency;
+  }
+  return total / static_cast<int64_t>(latencies.size());
+}
+
+void AppHost::excludeTime(int64_t time) const {
+  excludedTime += time;
+}
+
 void AppHost::recordFrame(int64_t drawTime) {
+  drawTime = std::max(drawTime - excludedTime, static_cast<int64_t>(0));
+  excludedTime = 0;
   auto currentTime = tgfx::Clock::Now();
   fpsTimeStamps.push_back(currentTime);
   while (fpsTimeStamps.size() > 60) {
@@ -120,11 +186,51 @@ void AppHost::recordFrame(int64_t drawTime) {
   while (drawTimes.size() > 60) {
     drawTimes.pop_front();
   }
+  virtualTime += VIRTUAL_FRAME_TIME;
+  scriptedFrames++;
+  updateScriptedMouse();
+}
+
+void AppHost::recordLatency(int64_t latency) {
+  latencies.push_back(latency);
+  while (latencies.size() > 60) {
+    latencies.pop_front();
+  }
+}
+
+void AppHost::recordGPUMemory(size_t memoryUsage, size_t purgeableBytes) {
+  _gpuMemoryUsage = memoryUsage;
+  _gpuPurgeableBytes = purgeableBytes;
+  _peakGPUMemoryUsage = std::max(_peakGPUMemoryUsage, memoryUsage);
 }
 
 void AppHost::resetFrames() {
   fpsTimeStamps.clear();
   drawTimes.clear();
+  latencies.clear();
+  _peakGPUMemoryUsage = 0;
+  excludedTime = 0;
+  scriptedFrames = 0;
+  updateScriptedMouse();
+}
+
+void AppHost::updateScriptedMouse() {
+  if (!IsDeterministic()) {
+    return;
+  }
+  auto width = static_cast<float>(_width);
+  auto height = static_cast<float>(_height);
+  if (!MousePath.empty()) {
+    auto& point = MousePath[static_cast<size_t>(scriptedFrames) % MousePath.size()];
+    _mouseX = point.x < 0 ? -1.0f : point.x * width;
+    _mouseY = point.y < 0 ? -1.0f : point.y * height;
+    return;
+  }
+  // A Lissajous curve that keeps a margin of 10% from the screen edges.
+  auto frame = static_cast<float>(scriptedFrames);
+  auto twoPi = 2.0f * static_cast<float>(M_PI);
+  _mouseX = width * (0.5f + 0.4f * std::sin(twoPi * frame / MOUSE_PERIOD_X));
+  _mouseY = height * (0.5f + 0.4f * std::sin(twoPi * frame / MOUSE_PERIOD_Y));
 }
 
 }  // namespace benchmark
\ No newline at end of file
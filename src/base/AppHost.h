@@ -19,6 +19,7 @@
 #pragma once
 
 #include <deque>
+#include <string>
 #include <unordered_map>
 #include "tgfx/core/Data.h"
 #include "tgfx/core/Image.h"
@@ -39,6 +40,26 @@ class AppHost {
 
   virtual ~AppHost() = default;
 
+  /**
+   * Enables or disables the deterministic mode for all app hosts. In this mode, currentTime()
+   * advances by a fixed step per recorded frame, and the mouse follows a scripted path that
+   * restarts on each resetFrames() call, so every run of a bench issues the same draw calls.
+   */
+  static void SetDeterministic(bool enabled);
+
+  /**
+   * Returns true if the deterministic mode is enabled.
+   */
+  static bool IsDeterministic();
+
+  /**
+   * Loads the scripted mouse path from a text file with one "x y" pair per frame, given as
+   * fractions of the screen size. Negative values place the mouse outside the screen, and the path
+   * loops when it runs out. Returns false if the file has no valid points, in which case the
+   * built-in path is used.
+   */
+  static bool LoadMousePath(const std::string& path);
+
   /**
    * Returns the width of the screen.
    */
@@ -74,6 +95,12 @@ class AppHost {
     return _mouseY;
   }
 
+  /**
+   * Returns the current time in microseconds. In deterministic mode, this is a virtual clock that
+   * advances by exactly one 60 fps frame in each recordFrame() call.
+   */
+  int64_t currentTime() const;
+
   /**
    * Returns the current frames per second. Returns 0 if the FPS is not available yet.
    */
@@ -91,6 +118,34 @@ class AppHost {
    */
   int64_t averageDrawTime() const;
 
+  /**
+   * Returns the average latency from reading the input to presenting a frame in microseconds.
+   * Returns 0 if no latency has been recorded yet.
+   */
+  int64_t averageLatency() const;
+
+  /**
+   * Returns the GPU memory used by the resources of the context after the last frame was flushed,
+   * in bytes. Returns 0 if the render loop does not report it.
+   */
+  size_t gpuMemoryUsage() const {
+    return _gpuMemoryUsage;
+  }
+
+  /**
+   * Returns the part of gpuMemoryUsage() held by resources that can be purged, in bytes.
+   */
+  size_t gpuPurgeableBytes() const {
+    return _gpuPurgeableBytes;
+  }
+
+  /**
+   * Returns the highest gpuMemoryUsage() since the last resetFrames() call, in bytes.
+   */
+  size_t peakGPUMemoryUsage() const {
+    return _peakGPUMemoryUsage;
+  }
+
   /**
    * Returns true if this is the first frame.
    */
@@ -116,9 +171,13 @@ class AppHost {
   bool updateScreen(int width, int height, float density);
 
   /**
-   * Updates the mouse position.
+   * Updates the mouse position. Ignored in deterministic mode, where the mouse follows the
+   * scripted path instead.
    */
   void mouseMoved(float mouseX, float mouseY) {
+    if (IsDeterministic()) {
+      return;
+    }
     this->_mouseX = mouseX;
     this->_mouseY = mouseY;
   }
@@ -133,24 +192,50 @@ class AppHost {
    */
   void addTypeface(const std::string& name, std::shared_ptr<tgfx::Typeface> typeface);
 
+  /**
+   * Leaves the given time in microseconds out of the draw time of the current frame. Benches call
+   * this for profiling passes that are not part of what they measure, so that the passes affect
+   * neither the draw count ramp nor the reported frame times.
+   */
+  void excludeTime(int64_t time) const;
+
   /**
    * Marks the end of a frame and records the frame time.
    */
   void recordFrame(int64_t drawTime);
 
+  /**
+   * Records the latency from reading the input to presenting a frame in microseconds.
+   */
+  void recordLatency(int64_t latency);
+
+  /**
+   * Records the GPU memory of the context, sampled by the render loop after flushing each frame.
+   */
+  void recordGPUMemory(size_t memoryUsage, size_t purgeableBytes);
+
   /**
    * Resets the app host to the first frame.
    */
   void resetFrames();
 
  private:
+  void updateScriptedMouse();
+
   int _width = 1024;
   int _height = 720;
   float _density = 1.0f;
   float _mouseX = -1.0f;
   float _mouseY = -1.0f;
+  int64_t virtualTime = 0;
+  int64_t scriptedFrames = 0;
+  size_t _gpuMemoryUsage = 0;
+  size_t _gpuPurgeableBytes = 0;
+  size_t _peakGPUMemoryUsage = 0;
+  mutable int64_t excludedTime = 0;
   std::deque<int64_t> fpsTimeStamps = {};
   std::deque<int64_t> drawTimes = {};
+  std::deque<int64_t> latencies = {};
   std::unordered_map<std::string, std::shared_ptr<tgfx::Image> > images = {};
   std::unordered_map<std::string, std::shared_ptr<tgfx::Typeface> > typefaces = {};
 };
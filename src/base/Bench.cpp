@@ -18,13 +18,62 @@
 
 #include "base/Bench.h"
 #include <unordered_map>
+#include "benchmark/BlendBench.h"
+#include "benchmark/CacheBench.h"
+#include "benchmark/ClipBench.h"
+#include "benchmark/CullingBench.h"
+#include "benchmark/ExportBench.h"
+#include "benchmark/ImageFilterBench.h"
+#include "benchmark/LayerTreeBench.h"
+#include "benchmark/MultiContextBench.h"
+#include "benchmark/PaintOrderBench.h"
 #include "benchmark/ParticleBench.h"
+#include "benchmark/PictureBench.h"
+#include "benchmark/PosterBench.h"
+#include "benchmark/ReadbackBench.h"
+#include "benchmark/ReplayBench.h"
+#include "benchmark/SaveLayerBench.h"
+#include "benchmark/SceneBench.h"
+#include "benchmark/ScrollBench.h"
+#include "benchmark/StrokeBench.h"
+#include "benchmark/ThumbnailBench.h"
+#include "benchmark/UISceneBench.h"
 #include "tgfx/platform/Print.h"
 
 namespace benchmark {
 static std::vector<Bench*> drawers = {
     new ParticleBench(GraphicType::Rect), new ParticleBench(GraphicType::Circle),
-    new ParticleBench(GraphicType::Oval), new ParticleBench(GraphicType::RRect)};
+    new ParticleBench(GraphicType::Oval), new ParticleBench(GraphicType::RRect),
+    new ImageFilterBench(ImageFilterType::Blur), new ImageFilterBench(ImageFilterType::DropShadow),
+    new ImageFilterBench(ImageFilterType::Compose), new BlendBench(tgfx::BlendMode::SrcOver),
+    new BlendBench(tgfx::BlendMode::Screen), new BlendBench(tgfx::BlendMode::Multiply),
+    new BlendBench(tgfx::BlendMode::Overlay), new BlendBench(tgfx::BlendMode::Difference),
+    new ClipBench(ClipShape::Rect), new ClipBench(ClipShape::RRect), new ClipBench(ClipShape::Path),
+    new SaveLayerBench(tgfx::BlendMode::SrcOver), new SaveLayerBench(tgfx::BlendMode::Multiply),
+    new PictureBench(PictureMode::Immediate), new PictureBench(PictureMode::Replay),
+    new PictureBench(PictureMode::Partial), new LayerTreeBench(tgfx::RenderMode::Direct),
+    new LayerTreeBench(tgfx::RenderMode::Partial), new ScrollBench(ScrollMode::Direct),
+    new ScrollBench(ScrollMode::Tiled), new CullingBench(CullingMode::Unculled),
+    new CullingBench(CullingMode::Culled), new PaintOrderBench(DrawOrder::Interleaved),
+    new PaintOrderBench(DrawOrder::Sorted), new PaintOrderBench(DrawOrder::Random),
+    new UISceneBench(), new StrokeBench(StrokeStyle::Hairline),
+    new StrokeBench(StrokeStyle::Thick), new StrokeBench(StrokeStyle::Dash),
+    new StrokeBench(StrokeStyle::Polyline), new ThumbnailBench(SurfaceMode::Fresh),
+    new ThumbnailBench(SurfaceMode::Pooled), new ReadbackBench(ReadbackMode::Sync),
+    new ReadbackBench(ReadbackMode::DoubleBuffered), new SceneBench(),
+    new CacheBench(CacheWorkload::Path), new CacheBench(CacheWorkload::Image),
+    new CacheBench(CacheWorkload::Glyph),
+#ifndef __EMSCRIPTEN__
+    // Offscreen devices cannot be created on worker threads in WebGL.
+    new MultiContextBench(ContextMode::Separate), new MultiContextBench(ContextMode::Shared),
+    new PosterBench(), new ExportBench(YUVFormat::I420), new ExportBench(YUVFormat::NV12),
+    // Capture files are loaded from the local file system.
+    new ReplayBench(),
+#endif
+};
+
+// The bench that drew the last frame.
+static Bench* activeBench = nullptr;
 
 static std::vector<std::string> GetDrawerNames() {
   std::vector<std::string> names;
@@ -79,6 +128,12 @@ void Bench::draw(tgfx::Canvas* canvas, const AppHost* host) {
     tgfx::PrintError("Drawer::draw() appHost is nullptr!");
     return;
   }
+  if (activeBench != this) {
+    if (activeBench != nullptr) {
+      activeBench->onExit(canvas);
+    }
+    activeBench = this;
+  }
   canvas->save();
   onDraw(canvas, host);
   canvas->restore();
@@ -57,9 +57,24 @@ class Bench {
    */
   void draw(tgfx::Canvas* canvas, const AppHost* host);
 
+  /**
+   * Returns the number of objects drawn in the last measured frames, or 0 if the bench does not
+   * report one.
+   */
+  virtual size_t currentDrawCount() const {
+    return 0;
+  }
+
  protected:
   virtual void onDraw(tgfx::Canvas* canvas, const AppHost* host) = 0;
 
+  /**
+   * Called before another bench draws its first frame. Benches that change the state of the
+   * shared context override this method to restore it.
+   */
+  virtual void onExit(tgfx::Canvas*) {
+  }
+
  private:
   std::string _name;
 };
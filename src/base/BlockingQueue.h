@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace benchmark {
+
+/**
+ * BlockingQueue is a thread-safe FIFO queue. The pop() method blocks until an item is available.
+ */
+template <typename T>
+class BlockingQueue {
+ public:
+  /**
+   * Appends an item to the end of the queue and wakes up one waiting consumer.
+   */
+  void push(T item) {
+    {
+      std::lock_guard<std::mutex> autoLock(locker);
+      items.push_back(std::move(item));
+    }
+    condition.notify_one();
+  }
+
+  /**
+   * Removes and returns the first item of the queue, waiting until one is available.
+   */
+  T pop() {
+    std::unique_lock<std::mutex> autoLock(locker);
+    condition.wait(autoLock, [this] { return !items.empty(); });
+    auto item = std::move(items.front());
+    items.pop_front();
+    return item;
+  }
+
+  /**
+   * Removes the first item of the queue into the given item without waiting. Returns false if the
+   * queue is empty.
+   */
+  bool tryPop(T* item) {
+    std::lock_guard<std::mutex> autoLock(locker);
+    if (items.empty()) {
+      return false;
+    }
+    *item = std::move(items.front());
+    items.pop_front();
+    return true;
+  }
+
+ private:
+  std::mutex locker = {};
+  std::condition_variable condition = {};
+  std::deque<T> items = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,474 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CaptureCanvas.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include "base/CaptureFormat.h"
+#include "tgfx/core/Surface.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+template <typename T>
+static void Write(std::vector<uint8_t>* buffer, T value) {
+  auto bytes = reinterpret_cast<const uint8_t*>(&value);
+  buffer->insert(buffer->end(), bytes, bytes + sizeof(T));
+}
+
+static void WriteOp(std::vector<uint8_t>* buffer, CaptureOp op) {
+  Write(buffer, static_cast<uint8_t>(op));
+}
+
+static void WriteRect(std::vector<uint8_t>* buffer, const tgfx::Rect& rect) {
+  Write(buffer, rect.left);
+  Write(buffer, rect.top);
+  Write(buffer, rect.right);
+  Write(buffer, rect.bottom);
+}
+
+static void WriteMatrix(std::vector<uint8_t>* buffer, const tgfx::Matrix& matrix) {
+  Write(buffer, matrix.getScaleX());
+  Write(buffer, matrix.getSkewX());
+  Write(buffer, matrix.getTranslateX());
+  Write(buffer, matrix.getSkewY());
+  Write(buffer, matrix.getScaleY());
+  Write(buffer, matrix.getTranslateY());
+}
+
+static void WriteColor(std::vector<uint8_t>* buffer, const tgfx::Color& color) {
+  Write(buffer, color.red);
+  Write(buffer, color.green);
+  Write(buffer, color.blue);
+  Write(buffer, color.alpha);
+}
+
+static void WritePaint(std::vector<uint8_t>* buffer, const tgfx::Paint& paint) {
+  WriteColor(buffer, paint.getColor());
+  uint8_t flags = 0;
+  if (paint.isAntiAlias()) {
+    flags |= CAPTURE_PAINT_ANTIALIAS;
+  }
+  if (paint.getStyle() == tgfx::PaintStyle::Stroke) {
+    flags |= CAPTURE_PAINT_STROKE;
+  }
+  Write(buffer, flags);
+  Write(buffer, static_cast<uint8_t>(paint.getBlendMode()));
+  Write(buffer, paint.getStrokeWidth());
+  Write(buffer, static_cast<uint8_t>(paint.getLineCap()));
+  Write(buffer, static_cast<uint8_t>(paint.getLineJoin()));
+  Write(buffer, paint.getMiterLimit());
+}
+
+static void WritePoints(std::vector<uint8_t>* buffer, const tgfx::Point points[], int count) {
+  for (int i = 0; i < count; i++) {
+    Write(buffer, points[i].x);
+    Write(buffer, points[i].y);
+  }
+}
+
+static void WritePath(std::vector<uint8_t>* buffer, const tgfx::Path& path) {
+  Write(buffer, static_cast<uint8_t>(path.getFillType()));
+  auto countOffset = buffer->size();
+  Write(buffer, static_cast<uint32_t>(0));
+  uint32_t verbCount = 0;
+  // Points of the Move verb come first, other verbs start at points[1] after the current point.
+  path.decompose([&](tgfx::PathVerb verb, const tgfx::Point points[4], void*) {
+    if (verb == tgfx::PathVerb::Move) {
+      Write(buffer, static_cast<uint8_t>(CaptureVerb::Move));
+      WritePoints(buffer, points, 1);
+    } else if (verb == tgfx::PathVerb::Line) {
+      Write(buffer, static_cast<uint8_t>(CaptureVerb::Line));
+      WritePoints(buffer, points + 1, 1);
+    } else if (verb == tgfx::PathVerb::Quad) {
+      Write(buffer, static_cast<uint8_t>(CaptureVerb::Quad));
+      WritePoints(buffer, points + 1, 2);
+    } else if (verb == tgfx::PathVerb::Cubic) {
+      Write(buffer, static_cast<uint8_t>(CaptureVerb::Cubic));
+      WritePoints(buffer, points + 1, 3);
+    } else if (verb == tgfx::PathVerb::Close) {
+      Write(buffer, static_cast<uint8_t>(CaptureVerb::Close));
+    } else {
+      return;
+    }
+    verbCount++;
+  });
+  memcpy(buffer->data() + countOffset, &verbCount, sizeof(verbCount));
+}
+
+static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037u;
+static constexpr uint64_t FNV_PRIME = 1099511628211u;
+
+// Hashes bytes with the 64-bit FNV-1a function.
+static uint64_t HashBytes(const uint8_t* bytes, size_t size, uint64_t hash = FNV_OFFSET_BASIS) {
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * FNV_PRIME;
+  }
+  return hash;
+}
+
+CaptureCanvas::CaptureCanvas(int width, int height) : _width(width), _height(height) {
+}
+
+CaptureCanvas::~CaptureCanvas() {
+  finish();
+}
+
+bool CaptureCanvas::open(const std::string& path) {
+  finish();
+  file.open(path, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+  if (!file) {
+    tgfx::PrintError("CaptureCanvas::open() failed to create %s!", path.c_str());
+    return false;
+  }
+  fileOffset = 0;
+  writeFailed = false;
+  blobOffsets.clear();
+  frameOffsets.clear();
+  blobIndices.clear();
+  imageEntries.clear();
+  // Reserves the header, which is rewritten with the index offsets in finish().
+  writeHeader();
+  return true;
+}
+
+bool CaptureCanvas::finish() {
+  if (!file.is_open()) {
+    return !writeFailed;
+  }
+  std::vector<uint8_t> index = {};
+  for (auto offset : blobOffsets) {
+    Write(&index, offset);
+  }
+  for (auto offset : frameOffsets) {
+    Write(&index, offset);
+  }
+  file.write(reinterpret_cast<const char*>(index.data()),
+             static_cast<std::streamsize>(index.size()));
+  file.seekp(0);
+  writeHeader();
+  writeFailed = writeFailed || !file;
+  file.close();
+  if (writeFailed) {
+    tgfx::PrintError("CaptureCanvas::finish() failed to write the capture file!");
+  }
+  return !writeFailed;
+}
+
+void CaptureCanvas::writeHeader() {
+  auto blobIndexOffset = fileOffset;
+  auto frameIndexOffset = blobIndexOffset + blobOffsets.size() * sizeof(uint64_t);
+  std::vector<uint8_t> header = {};
+  header.insert(header.end(), CAPTURE_MAGIC, CAPTURE_MAGIC + sizeof(CAPTURE_MAGIC));
+  Write(&header, CAPTURE_VERSION);
+  Write(&header, static_cast<int32_t>(_width));
+  Write(&header, static_cast<int32_t>(_height));
+  Write(&header, static_cast<uint32_t>(blobOffsets.size()));
+  Write(&header, static_cast<uint32_t>(frameOffsets.size()));
+  Write(&header, static_cast<uint32_t>(0));
+  Write(&header, static_cast<uint64_t>(blobIndexOffset));
+  Write(&header, static_cast<uint64_t>(frameIndexOffset));
+  file.write(reinterpret_cast<const char*>(header.data()),
+             static_cast<std::streamsize>(header.size()));
+  if (fileOffset == 0) {
+    fileOffset = CAPTURE_HEADER_SIZE;
+  }
+}
+
+void CaptureCanvas::writeChunk(CaptureChunk type, const std::vector<uint8_t>& header,
+                               const uint8_t* payload, size_t payloadSize) {
+  std::vector<uint8_t> chunkHeader = {};
+  Write(&chunkHeader, static_cast<uint32_t>(type));
+  Write(&chunkHeader, static_cast<uint32_t>(0));
+  Write(&chunkHeader, static_cast<uint64_t>(header.size() + payloadSize));
+  file.write(reinterpret_cast<const char*>(chunkHeader.data()),
+             static_cast<std::streamsize>(chunkHeader.size()));
+  file.write(reinterpret_cast<const char*>(header.data()),
+             static_cast<std::streamsize>(header.size()));
+  file.write(reinterpret_cast<const char*>(payload), static_cast<std::streamsize>(payloadSize));
+  auto size = CAPTURE_CHUNK_HEADER_SIZE + header.size() + payloadSize;
+  auto padding = (CAPTURE_ALIGNMENT - size % CAPTURE_ALIGNMENT) % CAPTURE_ALIGNMENT;
+  static constexpr char zeros[CAPTURE_ALIGNMENT] = {};
+  file.write(zeros, static_cast<std::streamsize>(padding));
+  fileOffset += size + padding;
+  writeFailed = writeFailed || !file;
+}
+
+uint32_t CaptureCanvas::writeBlob(CaptureChunk type, const std::vector<uint8_t>& header,
+                                  const uint8_t* payload, size_t payloadSize) {
+  auto hash = HashBytes(header.data(), header.size());
+  hash = HashBytes(reinterpret_cast<const uint8_t*>(&type), sizeof(type), hash);
+  hash = HashBytes(payload, payloadSize, hash);
+  auto& candidates = blobIndices[hash];
+  for (auto candidate : candidates) {
+    // The hash only narrows the search, a collision must not point a frame at the wrong blob.
+    if (blobEquals(candidate, type, header, payload, payloadSize)) {
+      return candidate;
+    }
+  }
+  auto blobIndex = static_cast<uint32_t>(blobOffsets.size());
+  blobOffsets.push_back(fileOffset);
+  candidates.push_back(blobIndex);
+  writeChunk(type, header, payload, payloadSize);
+  return blobIndex;
+}
+
+bool CaptureCanvas::blobEquals(uint32_t blobIndex, CaptureChunk type,
+                               const std::vector<uint8_t>& header, const uint8_t* payload,
+                               size_t payloadSize) {
+  auto contentSize = header.size() + payloadSize;
+  readBuffer.resize(CAPTURE_CHUNK_HEADER_SIZE + contentSize);
+  file.flush();
+  file.seekg(static_cast<std::streamoff>(blobOffsets[blobIndex]));
+  file.read(reinterpret_cast<char*>(readBuffer.data()),
+            static_cast<std::streamsize>(readBuffer.size()));
+  auto readSucceeded = static_cast<bool>(file);
+  file.clear();
+  file.seekp(static_cast<std::streamoff>(fileOffset));
+  if (!readSucceeded) {
+    // The stored blob is shorter than this one, which happens near the end of the file.
+    return false;
+  }
+  uint32_t storedType = 0;
+  uint64_t storedSize = 0;
+  memcpy(&storedType, readBuffer.data(), sizeof(storedType));
+  memcpy(&storedSize, readBuffer.data() + 8, sizeof(storedSize));
+  if (storedType != static_cast<uint32_t>(type) || storedSize != contentSize) {
+    return false;
+  }
+  auto content = readBuffer.data() + CAPTURE_CHUNK_HEADER_SIZE;
+  return std::equal(header.begin(), header.end(), content) &&
+         std::equal(payload, payload + payloadSize, content + header.size());
+}
+
+uint32_t CaptureCanvas::capturePath(const tgfx::Path& path) {
+  scratch.clear();
+  WritePath(&scratch, path);
+  return writeBlob(CaptureChunk::Path, {}, scratch.data(), scratch.size());
+}
+
+void CaptureCanvas::beginFrame(tgfx::Canvas* canvas) {
+  this->canvas = canvas;
+  commands.clear();
+}
+
+void CaptureCanvas::endFrame() {
+  if (file.is_open()) {
+    frameOffsets.push_back(fileOffset);
+    writeChunk(CaptureChunk::Frame, {}, commands.data(), commands.size());
+  }
+  commands.clear();
+  canvas = nullptr;
+}
+
+int CaptureCanvas::save() {
+  WriteOp(&commands, CaptureOp::Save);
+  return canvas ? canvas->save() : 0;
+}
+
+void CaptureCanvas::restore() {
+  WriteOp(&commands, CaptureOp::Restore);
+  if (canvas) {
+    canvas->restore();
+  }
+}
+
+int CaptureCanvas::saveLayerAlpha(float alpha) {
+  WriteOp(&commands, CaptureOp::SaveLayerAlpha);
+  Write(&commands, alpha);
+  return canvas ? canvas->saveLayerAlpha(alpha) : 0;
+}
+
+void CaptureCanvas::setMatrix(const tgfx::Matrix& matrix) {
+  WriteOp(&commands, CaptureOp::SetMatrix);
+  WriteMatrix(&commands, matrix);
+  if (canvas) {
+    canvas->setMatrix(matrix);
+  }
+}
+
+void CaptureCanvas::concat(const tgfx::Matrix& matrix) {
+  WriteOp(&commands, CaptureOp::Concat);
+  WriteMatrix(&commands, matrix);
+  if (canvas) {
+    canvas->concat(matrix);
+  }
+}
+
+void CaptureCanvas::clipRect(const tgfx::Rect& rect) {
+  WriteOp(&commands, CaptureOp::ClipRect);
+  WriteRect(&commands, rect);
+  if (canvas) {
+    canvas->clipRect(rect);
+  }
+}
+
+void CaptureCanvas::clipPath(const tgfx::Path& path) {
+  WriteOp(&commands, CaptureOp::ClipPath);
+  Write(&commands, capturePath(path));
+  if (canvas) {
+    canvas->clipPath(path);
+  }
+}
+
+void CaptureCanvas::clear(const tgfx::Color& color) {
+  WriteOp(&commands, CaptureOp::Clear);
+  WriteColor(&commands, color);
+  if (canvas) {
+    canvas->clear(color);
+  }
+}
+
+void CaptureCanvas::drawRect(const tgfx::Rect& rect, const tgfx::Paint& paint) {
+  WriteOp(&commands, CaptureOp::DrawRect);
+  WriteRect(&commands, rect);
+  WritePaint(&commands, paint);
+  if (canvas) {
+    canvas->drawRect(rect, paint);
+  }
+}
+
+void CaptureCanvas::drawRoundRect(const tgfx::Rect& rect, float radiusX, float radiusY,
+                                  const tgfx::Paint& paint) {
+  WriteOp(&commands, CaptureOp::DrawRoundRect);
+  WriteRect(&commands, rect);
+  Write(&commands, radiusX);
+  Write(&commands, radiusY);
+  WritePaint(&commands, paint);
+  if (canvas) {
+    canvas->drawRoundRect(rect, radiusX, radiusY, paint);
+  }
+}
+
+void CaptureCanvas::drawOval(const tgfx::Rect& oval, const tgfx::Paint& paint) {
+  WriteOp(&commands, CaptureOp::DrawOval);
+  WriteRect(&commands, oval);
+  WritePaint(&commands, paint);
+  if (canvas) {
+    canvas->drawOval(oval, paint);
+  }
+}
+
+void CaptureCanvas::drawCircle(float centerX, float centerY, float radius,
+                               const tgfx::Paint& paint) {
+  WriteOp(&commands, CaptureOp::DrawCircle);
+  Write(&commands, centerX);
+  Write(&commands, centerY);
+  Write(&commands, radius);
+  WritePaint(&commands, paint);
+  if (canvas) {
+    canvas->drawCircle(centerX, centerY, radius, paint);
+  }
+}
+
+void CaptureCanvas::drawPath(const tgfx::Path& path, const tgfx::Paint& paint) {
+  WriteOp(&commands, CaptureOp::DrawPath);
+  Write(&commands, capturePath(path));
+  WritePaint(&commands, paint);
+  if (canvas) {
+    canvas->drawPath(path, paint);
+  }
+}
+
+void CaptureCanvas::drawImage(std::shared_ptr<tgfx::Image> image, const tgfx::Matrix& matrix,
+                              const tgfx::Paint* paint) {
+  uint32_t blobIndex = 0;
+  if (captureImage(image, &blobIndex)) {
+    WriteOp(&commands, CaptureOp::DrawImage);
+    Write(&commands, blobIndex);
+    WriteMatrix(&commands, matrix);
+    Write(&commands, static_cast<uint8_t>(paint != nullptr));
+    if (paint != nullptr) {
+      WritePaint(&commands, *paint);
+    }
+  }
+  if (canvas) {
+    canvas->drawImage(std::move(image), matrix, paint);
+  }
+}
+
+void CaptureCanvas::drawImageRect(std::shared_ptr<tgfx::Image> image, const tgfx::Rect& dstRect,
+                                  const tgfx::SamplingOptions& sampling,
+                                  const tgfx::Paint* paint) {
+  uint32_t blobIndex = 0;
+  if (captureImage(image, &blobIndex)) {
+    WriteOp(&commands, CaptureOp::DrawImageRect);
+    Write(&commands, blobIndex);
+    WriteRect(&commands, dstRect);
+    Write(&commands, static_cast<uint8_t>(sampling.filterMode));
+    Write(&commands, static_cast<uint8_t>(sampling.mipmapMode));
+    Write(&commands, static_cast<uint8_t>(paint != nullptr));
+    if (paint != nullptr) {
+      WritePaint(&commands, *paint);
+    }
+  }
+  if (canvas) {
+    canvas->drawImageRect(std::move(image), dstRect, sampling, paint);
+  }
+}
+
+void CaptureCanvas::drawSimpleText(const std::string& text, float x, float y,
+                                   const tgfx::Font& font, const tgfx::Paint& paint) {
+  WriteOp(&commands, CaptureOp::DrawText);
+  Write(&commands, static_cast<uint32_t>(text.size()));
+  commands.insert(commands.end(), text.begin(), text.end());
+  Write(&commands, x);
+  Write(&commands, y);
+  Write(&commands, font.getSize());
+  WritePaint(&commands, paint);
+  if (canvas) {
+    canvas->drawSimpleText(text, x, y, font, paint);
+  }
+}
+
+bool CaptureCanvas::captureImage(const std::shared_ptr<tgfx::Image>& image, uint32_t* blobIndex) {
+  if (image == nullptr || !file.is_open()) {
+    return false;
+  }
+  auto result = imageEntries.find(image.get());
+  if (result != imageEntries.end() && result->second.image.lock() == image) {
+    *blobIndex = result->second.blobIndex;
+    return true;
+  }
+  auto surface = canvas ? canvas->getSurface() : nullptr;
+  auto context = surface ? surface->getContext() : nullptr;
+  if (context == nullptr) {
+    tgfx::PrintWarn("CaptureCanvas: images need a GPU-backed canvas and are skipped.");
+    return false;
+  }
+  auto imageSurface = tgfx::Surface::Make(context, image->width(), image->height());
+  if (imageSurface == nullptr) {
+    return false;
+  }
+  imageSurface->getCanvas()->drawImage(image);
+  auto info = tgfx::ImageInfo::Make(image->width(), image->height(), tgfx::ColorType::RGBA_8888,
+                                    tgfx::AlphaType::Premultiplied);
+  scratch.resize(info.byteSize());
+  if (!imageSurface->readPixels(info, scratch.data())) {
+    return false;
+  }
+  std::vector<uint8_t> header = {};
+  Write(&header, static_cast<int32_t>(image->width()));
+  Write(&header, static_cast<int32_t>(image->height()));
+  Write(&header, static_cast<uint64_t>(0));
+  *blobIndex = writeBlob(CaptureChunk::Image, header, scratch.data(), scratch.size());
+  imageEntries[image.get()] = {image, *blobIndex};
+  return true;
+}
+
+}  // namespace benchmark
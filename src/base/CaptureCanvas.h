@@ -0,0 +1,159 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "base/CaptureFormat.h"
+#include "tgfx/core/Canvas.h"
+
+namespace benchmark {
+
+/**
+ * CaptureCanvas records the draw calls of real app frames into a capture file that ReplayBench
+ * can play back. It mirrors the subset of the tgfx::Canvas API listed in CaptureFormat.h: each
+ * call is recorded and then forwarded to the canvas passed to beginFrame(), so an app can route its
+ * drawing through a CaptureCanvas and keep rendering as usual while capturing. Frames are streamed
+ * to the file as they end, and paths and images are written only once no matter how many frames
+ * use them, so long animations can be captured with constant memory. Images are read back on first
+ * use and stored as raw pixels, and text is replayed with the default typeface of the bench host
+ * at the captured font size.
+ */
+class CaptureCanvas {
+ public:
+  /**
+   * Creates a CaptureCanvas for frames of the given size in pixels.
+   */
+  CaptureCanvas(int width, int height);
+
+  /**
+   * Finishes the capture file if it is still open.
+   */
+  ~CaptureCanvas();
+
+  /**
+   * Creates the capture file at the given path, finishing the current one first. Returns false if
+   * the file cannot be created.
+   */
+  bool open(const std::string& path);
+
+  /**
+   * Writes the indices of the capture file and closes it. Returns false if writing the file has
+   * failed at any point.
+   */
+  bool finish();
+
+  /**
+   * Starts recording a new frame. The calls are forwarded to the given canvas, which may be
+   * nullptr to record without drawing. Images can only be captured with a GPU-backed canvas.
+   */
+  void beginFrame(tgfx::Canvas* canvas);
+
+  /**
+   * Finishes the current frame and appends it to the capture file.
+   */
+  void endFrame();
+
+  /**
+   * Returns the number of finished frames.
+   */
+  size_t frameCount() const {
+    return frameOffsets.size();
+  }
+
+  int save();
+
+  void restore();
+
+  int saveLayerAlpha(float alpha);
+
+  void setMatrix(const tgfx::Matrix& matrix);
+
+  void concat(const tgfx::Matrix& matrix);
+
+  void clipRect(const tgfx::Rect& rect);
+
+  void clipPath(const tgfx::Path& path);
+
+  void clear(const tgfx::Color& color = tgfx::Color::Transparent());
+
+  void drawRect(const tgfx::Rect& rect, const tgfx::Paint& paint);
+
+  void drawRoundRect(const tgfx::Rect& rect, float radiusX, float radiusY,
+                     const tgfx::Paint& paint);
+
+  void drawOval(const tgfx::Rect& oval, const tgfx::Paint& paint);
+
+  void drawCircle(float centerX, float centerY, float radius, const tgfx::Paint& paint);
+
+  void drawPath(const tgfx::Path& path, const tgfx::Paint& paint);
+
+  void drawImage(std::shared_ptr<tgfx::Image> image, const tgfx::Matrix& matrix,
+                 const tgfx::Paint* paint = nullptr);
+
+  void drawImageRect(std::shared_ptr<tgfx::Image> image, const tgfx::Rect& dstRect,
+                     const tgfx::SamplingOptions& sampling = {},
+                     const tgfx::Paint* paint = nullptr);
+
+  void drawSimpleText(const std::string& text, float x, float y, const tgfx::Font& font,
+                      const tgfx::Paint& paint);
+
+ private:
+  struct ImageEntry {
+    // Detects a new image allocated at the address of a released one.
+    std::weak_ptr<tgfx::Image> image = {};
+    uint32_t blobIndex = 0;
+  };
+
+  void writeHeader();
+
+  void writeChunk(CaptureChunk type, const std::vector<uint8_t>& header, const uint8_t* payload,
+                  size_t payloadSize);
+
+  uint32_t writeBlob(CaptureChunk type, const std::vector<uint8_t>& header, const uint8_t* payload,
+                     size_t payloadSize);
+
+  bool blobEquals(uint32_t blobIndex, CaptureChunk type, const std::vector<uint8_t>& header,
+                  const uint8_t* payload, size_t payloadSize);
+
+  uint32_t capturePath(const tgfx::Path& path);
+
+  bool captureImage(const std::shared_ptr<tgfx::Image>& image, uint32_t* blobIndex);
+
+  int _width = 0;
+  int _height = 0;
+  tgfx::Canvas* canvas = nullptr;
+  // Opened for reading too, so that blobs with equal hashes can be compared byte by byte.
+  std::fstream file = {};
+  uint64_t fileOffset = 0;
+  bool writeFailed = false;
+  std::vector<uint8_t> commands = {};
+  std::vector<uint8_t> scratch = {};
+  std::vector<uint64_t> blobOffsets = {};
+  std::vector<uint64_t> frameOffsets = {};
+  // Maps a 64-bit hash of the blob content to the indices of the blobs having it, so repeated
+  // blobs are written once.
+  std::unordered_map<uint64_t, std::vector<uint32_t>> blobIndices = {};
+  std::vector<uint8_t> readBuffer = {};
+  std::unordered_map<const tgfx::Image*, ImageEntry> imageEntries = {};
+};
+
+}  // namespace benchmark
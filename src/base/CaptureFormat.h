@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace benchmark {
+
+/**
+ * The layout of a capture file, written by CaptureCanvas and read by CaptureReader. All values are
+ * little-endian. The file is a header followed by 16-byte aligned chunks and two indices, so that
+ * it can be memory-mapped and read in place:
+ *
+ *   Header: magic "TGFXCAP\0", uint32 version, int32 width, int32 height, uint32 blobCount,
+ *           uint32 frameCount, uint32 reserved, uint64 blobIndexOffset, uint64 frameIndexOffset
+ *   Chunks: { uint32 CaptureChunk type, uint32 reserved, uint64 payload size, payload, padding }
+ *   Blob index: blobCount uint64 chunk offsets.
+ *   Frame index: frameCount uint64 chunk offsets.
+ *
+ * Paths and images are stored once as blob chunks and referenced by their uint32 blob index, in
+ * the order they are first used. A blob chunk always precedes the frames referring to it, so the
+ * writer streams the file without keeping past frames in memory. The payload of a path blob is a
+ * fill type byte and a uint32 verb count followed by each CaptureVerb byte and its points. The
+ * payload of an image blob is int32 width, int32 height and 8 reserved bytes, followed by
+ * premultiplied RGBA pixels, which keeps the pixels 16-byte aligned.
+ *
+ * The payload of a frame chunk is a list of commands, each a CaptureOp byte followed by its
+ * arguments. Rects are 4 floats (left, top, right, bottom) and matrices are 6 floats (scaleX,
+ * skewX, transX, skewY, scaleY, transY).
+ */
+static constexpr char CAPTURE_MAGIC[8] = {'T', 'G', 'F', 'X', 'C', 'A', 'P', '\0'};
+static constexpr uint32_t CAPTURE_VERSION = 2;
+static constexpr size_t CAPTURE_HEADER_SIZE = 48;
+static constexpr size_t CAPTURE_CHUNK_HEADER_SIZE = 16;
+static constexpr size_t CAPTURE_IMAGE_HEADER_SIZE = 16;
+static constexpr size_t CAPTURE_ALIGNMENT = 16;
+
+enum class CaptureChunk : uint32_t { Path = 1, Image = 2, Frame = 3 };
+
+enum class CaptureOp : uint8_t {
+  // No arguments.
+  Save,
+  // No arguments.
+  Restore,
+  // float alpha.
+  SaveLayerAlpha,
+  // Matrix matrix.
+  SetMatrix,
+  // Matrix matrix.
+  Concat,
+  // Rect rect.
+  ClipRect,
+  // uint32 pathBlob.
+  ClipPath,
+  // float red, green, blue, alpha.
+  Clear,
+  // Rect rect, Paint paint.
+  DrawRect,
+  // Rect rect, float radiusX, float radiusY, Paint paint.
+  DrawRoundRect,
+  // Rect rect, Paint paint.
+  DrawOval,
+  // float centerX, float centerY, float radius, Paint paint.
+  DrawCircle,
+  // uint32 pathBlob, Paint paint.
+  DrawPath,
+  // uint32 imageBlob, Matrix matrix, uint8 hasPaint, Paint paint if hasPaint is 1.
+  DrawImage,
+  // uint32 imageBlob, Rect dst, uint8 filterMode, uint8 mipmapMode, uint8 hasPaint, Paint paint
+  // if hasPaint is 1.
+  DrawImageRect,
+  // uint32 length, UTF-8 text, float x, float y, float fontSize, Paint paint.
+  DrawText
+};
+
+enum class CaptureVerb : uint8_t {
+  // One point.
+  Move,
+  // One point.
+  Line,
+  // Two points.
+  Quad,
+  // Three points.
+  Cubic,
+  // No points.
+  Close
+};
+
+/**
+ * A paint is stored as float red, green, blue, alpha, uint8 flags (CAPTURE_PAINT_ANTIALIAS and
+ * CAPTURE_PAINT_STROKE), uint8 blendMode, then float strokeWidth, uint8 lineCap, uint8 lineJoin
+ * and float miterLimit. Shaders, color filters, image filters and mask filters are not captured.
+ */
+static constexpr uint8_t CAPTURE_PAINT_ANTIALIAS = 1 << 0;
+static constexpr uint8_t CAPTURE_PAINT_STROKE = 1 << 1;
+
+}  // namespace benchmark
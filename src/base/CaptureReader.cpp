@@ -0,0 +1,443 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CaptureReader.h"
+#include <cstring>
+#include "tgfx/core/Image.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+// The number of played frames a cached path or image survives without being used.
+static constexpr int64_t CACHE_FRAMES = 120;
+
+/**
+ * Reads little-endian values from a byte range, failing once a read would run past its end.
+ */
+class ByteReader {
+ public:
+  ByteReader(const uint8_t* bytes, size_t size) : bytes(bytes), size(size) {
+  }
+
+  bool isValid() const {
+    return valid;
+  }
+
+  bool atEnd() const {
+    return position >= size;
+  }
+
+  size_t offset() const {
+    return position;
+  }
+
+  template <typename T>
+  T read() {
+    T value = {};
+    auto source = readBytes(sizeof(T));
+    if (source != nullptr) {
+      memcpy(&value, source, sizeof(T));
+    }
+    return value;
+  }
+
+  const uint8_t* readBytes(size_t length) {
+    if (!valid || length > size - position) {
+      valid = false;
+      return nullptr;
+    }
+    auto result = bytes + position;
+    position += length;
+    return result;
+  }
+
+ private:
+  const uint8_t* bytes = nullptr;
+  size_t size = 0;
+  size_t position = 0;
+  bool valid = true;
+};
+
+static tgfx::Rect ReadRect(ByteReader* reader) {
+  auto left = reader->read<float>();
+  auto top = reader->read<float>();
+  auto right = reader->read<float>();
+  auto bottom = reader->read<float>();
+  return tgfx::Rect::MakeLTRB(left, top, right, bottom);
+}
+
+static tgfx::Matrix ReadMatrix(ByteReader* reader) {
+  float values[6] = {};
+  for (auto& value : values) {
+    value = reader->read<float>();
+  }
+  return tgfx::Matrix::MakeAll(values[0], values[1], values[2], values[3], values[4], values[5]);
+}
+
+static tgfx::Color ReadColor(ByteReader* reader) {
+  tgfx::Color color = {};
+  color.red = reader->read<float>();
+  color.green = reader->read<float>();
+  color.blue = reader->read<float>();
+  color.alpha = reader->read<float>();
+  return color;
+}
+
+static tgfx::Paint ReadPaint(ByteReader* reader) {
+  tgfx::Paint paint = {};
+  paint.setColor(ReadColor(reader));
+  auto flags = reader->read<uint8_t>();
+  paint.setAntiAlias((flags & CAPTURE_PAINT_ANTIALIAS) != 0);
+  paint.setStyle((flags & CAPTURE_PAINT_STROKE) != 0 ? tgfx::PaintStyle::Stroke
+                                                     : tgfx::PaintStyle::Fill);
+  paint.setBlendMode(static_cast<tgfx::BlendMode>(reader->read<uint8_t>()));
+  paint.setStrokeWidth(reader->read<float>());
+  paint.setLineCap(static_cast<tgfx::LineCap>(reader->read<uint8_t>()));
+  paint.setLineJoin(static_cast<tgfx::LineJoin>(reader->read<uint8_t>()));
+  paint.setMiterLimit(reader->read<float>());
+  return paint;
+}
+
+static tgfx::Path ReadPath(ByteReader* reader) {
+  tgfx::Path path = {};
+  path.setFillType(static_cast<tgfx::PathFillType>(reader->read<uint8_t>()));
+  auto verbCount = reader->read<uint32_t>();
+  float points[6] = {};
+  for (uint32_t i = 0; i < verbCount && reader->isValid(); i++) {
+    auto verb = static_cast<CaptureVerb>(reader->read<uint8_t>());
+    int pointCount = 0;
+    switch (verb) {
+      case CaptureVerb::Move:
+      case CaptureVerb::Line:
+        pointCount = 1;
+        break;
+      case CaptureVerb::Quad:
+        pointCount = 2;
+        break;
+      case CaptureVerb::Cubic:
+        pointCount = 3;
+        break;
+      case CaptureVerb::Close:
+        break;
+    }
+    for (int j = 0; j < pointCount * 2; j++) {
+      points[j] = reader->read<float>();
+    }
+    switch (verb) {
+      case CaptureVerb::Move:
+        path.moveTo(points[0], points[1]);
+        break;
+      case CaptureVerb::Line:
+        path.lineTo(points[0], points[1]);
+        break;
+      case CaptureVerb::Quad:
+        path.quadTo(points[0], points[1], points[2], points[3]);
+        break;
+      case CaptureVerb::Cubic:
+        path.cubicTo(points[0], points[1], points[2], points[3], points[4], points[5]);
+        break;
+      case CaptureVerb::Close:
+        path.close();
+        break;
+    }
+  }
+  return path;
+}
+
+static uint64_t ReadOffset(const uint8_t* index, size_t position) {
+  uint64_t offset = 0;
+  memcpy(&offset, index + position * sizeof(uint64_t), sizeof(uint64_t));
+  return offset;
+}
+
+static void ReleaseMappedFile(const void*, void* context) {
+  delete static_cast<std::shared_ptr<MappedFile>*>(context);
+}
+
+bool CaptureReader::open(const std::string& path) {
+  close();
+  auto mappedFile = std::make_shared<MappedFile>();
+  if (!mappedFile->open(path)) {
+    return false;
+  }
+  ByteReader reader(mappedFile->bytes(), mappedFile->size());
+  auto magic = reader.readBytes(sizeof(CAPTURE_MAGIC));
+  if (magic == nullptr || memcmp(magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)) != 0 ||
+      reader.read<uint32_t>() != CAPTURE_VERSION) {
+    tgfx::PrintError("CaptureReader::open() %s is not a supported capture!", path.c_str());
+    return false;
+  }
+  auto width = reader.read<int32_t>();
+  auto height = reader.read<int32_t>();
+  auto blobs = static_cast<size_t>(reader.read<uint32_t>());
+  auto frames = static_cast<size_t>(reader.read<uint32_t>());
+  reader.read<uint32_t>();
+  auto blobIndexOffset = reader.read<uint64_t>();
+  auto frameIndexOffset = reader.read<uint64_t>();
+  auto fileSize = static_cast<uint64_t>(mappedFile->size());
+  if (!reader.isValid() || width <= 0 || height <= 0 || blobIndexOffset > fileSize ||
+      blobs > (fileSize - blobIndexOffset) / sizeof(uint64_t) || frameIndexOffset > fileSize ||
+      frames > (fileSize - frameIndexOffset) / sizeof(uint64_t)) {
+    tgfx::PrintError("CaptureReader::open() %s is truncated or unfinished!", path.c_str());
+    return false;
+  }
+  _width = width;
+  _height = height;
+  blobCount = blobs;
+  _frameCount = frames;
+  blobIndex = mappedFile->bytes() + blobIndexOffset;
+  frameIndex = mappedFile->bytes() + frameIndexOffset;
+  file = std::move(mappedFile);
+  return true;
+}
+
+void CaptureReader::close() {
+  // Images still in use elsewhere keep the file mapped through their pixel data.
+  paths.clear();
+  images.clear();
+  file = nullptr;
+  _width = 0;
+  _height = 0;
+  blobCount = 0;
+  _frameCount = 0;
+  blobIndex = nullptr;
+  frameIndex = nullptr;
+  playedFrames = 0;
+}
+
+const uint8_t* CaptureReader::findChunk(uint64_t offset, CaptureChunk type, size_t* size) const {
+  auto fileSize = static_cast<uint64_t>(file->size());
+  if (offset > fileSize || fileSize - offset < CAPTURE_CHUNK_HEADER_SIZE) {
+    return nullptr;
+  }
+  ByteReader reader(file->bytes() + offset, CAPTURE_CHUNK_HEADER_SIZE);
+  auto chunkType = reader.read<uint32_t>();
+  reader.read<uint32_t>();
+  auto payloadSize = reader.read<uint64_t>();
+  if (chunkType != static_cast<uint32_t>(type) ||
+      payloadSize > fileSize - offset - CAPTURE_CHUNK_HEADER_SIZE) {
+    return nullptr;
+  }
+  *size = static_cast<size_t>(payloadSize);
+  return file->bytes() + offset + CAPTURE_CHUNK_HEADER_SIZE;
+}
+
+const tgfx::Path* CaptureReader::getPath(uint32_t index) {
+  auto result = paths.find(index);
+  if (result != paths.end()) {
+    result->second.lastUsedFrame = playedFrames;
+    return &result->second.value;
+  }
+  size_t size = 0;
+  auto payload = index < blobCount
+                     ? findChunk(ReadOffset(blobIndex, index), CaptureChunk::Path, &size)
+                     : nullptr;
+  if (payload == nullptr) {
+    return nullptr;
+  }
+  ByteReader reader(payload, size);
+  auto& entry = paths[index];
+  entry.value = ReadPath(&reader);
+  entry.lastUsedFrame = playedFrames;
+  return &entry.value;
+}
+
+std::shared_ptr<tgfx::Image> CaptureReader::getImage(uint32_t index) {
+  auto result = images.find(index);
+  if (result != images.end()) {
+    result->second.lastUsedFrame = playedFrames;
+    return result->second.value;
+  }
+  size_t size = 0;
+  auto payload = index < blobCount
+                     ? findChunk(ReadOffset(blobIndex, index), CaptureChunk::Image, &size)
+                     : nullptr;
+  if (payload == nullptr || size < CAPTURE_IMAGE_HEADER_SIZE) {
+    return nullptr;
+  }
+  ByteReader reader(payload, size);
+  auto imageWidth = reader.read<int32_t>();
+  auto imageHeight = reader.read<int32_t>();
+  if (imageWidth <= 0 || imageHeight <= 0) {
+    return nullptr;
+  }
+  auto info = tgfx::ImageInfo::Make(imageWidth, imageHeight, tgfx::ColorType::RGBA_8888,
+                                    tgfx::AlphaType::Premultiplied);
+  if (info.byteSize() > size - CAPTURE_IMAGE_HEADER_SIZE) {
+    return nullptr;
+  }
+  // Wraps the mapped pixels without copying them, keeping the file mapped while the data lives.
+  auto pixels = tgfx::Data::MakeAdopted(payload + CAPTURE_IMAGE_HEADER_SIZE, info.byteSize(),
+                                        ReleaseMappedFile,
+                                        new std::shared_ptr<MappedFile>(file));
+  auto& entry = images[index];
+  entry.value = tgfx::Image::MakeFrom(info, std::move(pixels));
+  entry.lastUsedFrame = playedFrames;
+  return entry.value;
+}
+
+void CaptureReader::purgeCaches() {
+  for (auto item = paths.begin(); item != paths.end();) {
+    if (playedFrames - item->second.lastUsedFrame > CACHE_FRAMES) {
+      item = paths.erase(item);
+    } else {
+      ++item;
+    }
+  }
+  for (auto item = images.begin(); item != images.end();) {
+    if (playedFrames - item->second.lastUsedFrame > CACHE_FRAMES) {
+      item = images.erase(item);
+    } else {
+      ++item;
+    }
+  }
+}
+
+size_t CaptureReader::playFrame(size_t index, tgfx::Canvas* canvas,
+                                const tgfx::Matrix& baseMatrix,
+                                const std::shared_ptr<tgfx::Typeface>& typeface) {
+  size_t size = 0;
+  auto commands = index < _frameCount
+                      ? findChunk(ReadOffset(frameIndex, index), CaptureChunk::Frame, &size)
+                      : nullptr;
+  if (commands == nullptr) {
+    return 0;
+  }
+  playedFrames++;
+  ByteReader reader(commands, size);
+  auto saveCount = canvas->save();
+  canvas->setMatrix(baseMatrix);
+  size_t commandCount = 0;
+  tgfx::Font font(typeface, 12.f);
+  while (!reader.atEnd()) {
+    auto op = static_cast<CaptureOp>(reader.read<uint8_t>());
+    switch (op) {
+      case CaptureOp::Save:
+        canvas->save();
+        break;
+      case CaptureOp::Restore:
+        // Never pops the save pushed above, even if the capture has unbalanced restores.
+        if (canvas->getSaveCount() > saveCount + 1) {
+          canvas->restore();
+        }
+        break;
+      case CaptureOp::SaveLayerAlpha:
+        canvas->saveLayerAlpha(reader.read<float>());
+        break;
+      case CaptureOp::SetMatrix: {
+        auto matrix = ReadMatrix(&reader);
+        canvas->setMatrix(baseMatrix);
+        canvas->concat(matrix);
+        break;
+      }
+      case CaptureOp::Concat:
+        canvas->concat(ReadMatrix(&reader));
+        break;
+      case CaptureOp::ClipRect:
+        canvas->clipRect(ReadRect(&reader));
+        break;
+      case CaptureOp::ClipPath: {
+        auto path = getPath(reader.read<uint32_t>());
+        if (path != nullptr) {
+          canvas->clipPath(*path);
+        }
+        break;
+      }
+      case CaptureOp::Clear:
+        canvas->clear(ReadColor(&reader));
+        break;
+      case CaptureOp::DrawRect: {
+        auto rect = ReadRect(&reader);
+        canvas->drawRect(rect, ReadPaint(&reader));
+        break;
+      }
+      case CaptureOp::DrawRoundRect: {
+        auto rect = ReadRect(&reader);
+        auto radiusX = reader.read<float>();
+        auto radiusY = reader.read<float>();
+        canvas->drawRoundRect(rect, radiusX, radiusY, ReadPaint(&reader));
+        break;
+      }
+      case CaptureOp::DrawOval: {
+        auto oval = ReadRect(&reader);
+        canvas->drawOval(oval, ReadPaint(&reader));
+        break;
+      }
+      case CaptureOp::DrawCircle: {
+        auto centerX = reader.read<float>();
+        auto centerY = reader.read<float>();
+        auto radius = reader.read<float>();
+        canvas->drawCircle(centerX, centerY, radius, ReadPaint(&reader));
+        break;
+      }
+      case CaptureOp::DrawPath: {
+        auto path = getPath(reader.read<uint32_t>());
+        auto paint = ReadPaint(&reader);
+        if (path != nullptr) {
+          canvas->drawPath(*path, paint);
+        }
+        break;
+      }
+      case CaptureOp::DrawImage: {
+        auto image = getImage(reader.read<uint32_t>());
+        auto matrix = ReadMatrix(&reader);
+        auto paint = reader.read<uint8_t>() != 0 ? ReadPaint(&reader) : tgfx::Paint();
+        if (image != nullptr) {
+          canvas->drawImage(std::move(image), matrix, &paint);
+        }
+        break;
+      }
+      case CaptureOp::DrawImageRect: {
+        auto image = getImage(reader.read<uint32_t>());
+        auto dstRect = ReadRect(&reader);
+        auto filterMode = static_cast<tgfx::FilterMode>(reader.read<uint8_t>());
+        auto mipmapMode = static_cast<tgfx::MipmapMode>(reader.read<uint8_t>());
+        auto paint = reader.read<uint8_t>() != 0 ? ReadPaint(&reader) : tgfx::Paint();
+        if (image != nullptr) {
+          canvas->drawImageRect(std::move(image), dstRect,
+                                tgfx::SamplingOptions(filterMode, mipmapMode), &paint);
+        }
+        break;
+      }
+      case CaptureOp::DrawText: {
+        auto length = reader.read<uint32_t>();
+        auto text = reader.readBytes(length);
+        auto x = reader.read<float>();
+        auto y = reader.read<float>();
+        font.setSize(reader.read<float>());
+        auto paint = ReadPaint(&reader);
+        if (text != nullptr) {
+          canvas->drawSimpleText(std::string(reinterpret_cast<const char*>(text), length), x, y,
+                                 font, paint);
+        }
+        break;
+      }
+      default:
+        reader.readBytes(size);
+        break;
+    }
+    if (!reader.isValid()) {
+      break;
+    }
+    commandCount++;
+  }
+  canvas->restoreToCount(saveCount);
+  purgeCaches();
+  return commandCount;
+}
+
+}  // namespace benchmark
@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "base/CaptureFormat.h"
+#include "base/MappedFile.h"
+#include "tgfx/core/Canvas.h"
+
+namespace benchmark {
+
+/**
+ * CaptureReader memory-maps a capture file written by CaptureCanvas and plays its frames back onto
+ * a canvas. Opening a capture only reads its header, and playing a frame looks it up in the frame
+ * index and decodes its commands in place, as a real app would issue them. Paths and images are
+ * created from the mapped blobs on first use and dropped again once no frame has used them for a
+ * while, so the heap usage stays constant no matter how long the capture is. Images wrap the mapped
+ * pixels without copying them.
+ */
+class CaptureReader {
+ public:
+  /**
+   * Maps the capture file at the given path, replacing the current one. Returns false if the file
+   * cannot be mapped or is not a valid capture.
+   */
+  bool open(const std::string& path);
+
+  /**
+   * Releases the mapped capture and the cached paths and images.
+   */
+  void close();
+
+  /**
+   * Returns the width of the captured frames in pixels.
+   */
+  int width() const {
+    return _width;
+  }
+
+  /**
+   * Returns the height of the captured frames in pixels.
+   */
+  int height() const {
+    return _height;
+  }
+
+  /**
+   * Returns the number of captured frames.
+   */
+  size_t frameCount() const {
+    return _frameCount;
+  }
+
+  /**
+   * Returns the size of the mapped capture file in bytes.
+   */
+  size_t mappedSize() const {
+    return file ? file->size() : 0;
+  }
+
+  /**
+   * Returns the number of paths and images currently cached.
+   */
+  size_t cachedBlobCount() const {
+    return paths.size() + images.size();
+  }
+
+  /**
+   * Plays the frame with the given index onto the canvas. The captured matrices are applied on top
+   * of the given base matrix, and text is drawn with the given typeface. The canvas state is
+   * restored afterward. Returns the number of commands played, which is less than the number of
+   * captured commands if the frame data is corrupted.
+   */
+  size_t playFrame(size_t index, tgfx::Canvas* canvas, const tgfx::Matrix& baseMatrix,
+                   const std::shared_ptr<tgfx::Typeface>& typeface);
+
+ private:
+  template <typename T>
+  struct CacheEntry {
+    T value = {};
+    int64_t lastUsedFrame = 0;
+  };
+
+  const uint8_t* findChunk(uint64_t offset, CaptureChunk type, size_t* size) const;
+
+  const tgfx::Path* getPath(uint32_t blobIndex);
+
+  std::shared_ptr<tgfx::Image> getImage(uint32_t blobIndex);
+
+  void purgeCaches();
+
+  std::shared_ptr<MappedFile> file = nullptr;
+  int _width = 0;
+  int _height = 0;
+  size_t blobCount = 0;
+  size_t _frameCount = 0;
+  const uint8_t* blobIndex = nullptr;
+  const uint8_t* frameIndex = nullptr;
+  int64_t playedFrames = 0;
+  std::unordered_map<uint32_t, CacheEntry<tgfx::Path>> paths = {};
+  std::unordered_map<uint32_t, CacheEntry<std::shared_ptr<tgfx::Image>>> images = {};
+};
+
+}  // namespace benchmark
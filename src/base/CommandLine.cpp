@@ -0,0 +1,176 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CommandLine.h"
+#include <cstdlib>
+#include "base/AppHost.h"
+#include "base/FramePipeline.h"
+#include "base/FrameValidator.h"
+#include "base/MemoryTracker.h"
+#include "base/SoakRunner.h"
+#include "benchmark/LayerTreeBench.h"
+#include "benchmark/PictureBench.h"
+#include "benchmark/PosterBench.h"
+#include "benchmark/ReplayBench.h"
+#include "benchmark/SceneBench.h"
+#include "benchmark/ScrollBench.h"
+#include "benchmark/UISceneBench.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+static bool ParseInt(const std::string& text, int* value) {
+  if (text.empty()) {
+    return false;
+  }
+  char* end = nullptr;
+  auto result = std::strtol(text.c_str(), &end, 10);
+  if (*end != '\0') {
+    return false;
+  }
+  *value = static_cast<int>(result);
+  return true;
+}
+
+static bool ParseFloat(const std::string& text, float* value) {
+  if (text.empty()) {
+    return false;
+  }
+  char* end = nullptr;
+  auto result = std::strtof(text.c_str(), &end);
+  if (*end != '\0') {
+    return false;
+  }
+  *value = result;
+  return true;
+}
+
+static bool ParseFloats(const std::string& text, float* values, size_t count) {
+  size_t start = 0;
+  for (size_t i = 0; i < count; i++) {
+    auto end = text.find(',', start);
+    if ((end == std::string::npos) != (i == count - 1)) {
+      return false;
+    }
+    if (!ParseFloat(text.substr(start, end - start), values + i)) {
+      return false;
+    }
+    start = end + 1;
+  }
+  return true;
+}
+
+void CommandLine::Apply(const std::vector<std::string>& args) {
+  for (auto& arg : args) {
+    auto separator = arg.find('=');
+    auto name = arg.substr(0, separator);
+    auto value = separator == std::string::npos ? "" : arg.substr(separator + 1);
+    if (name == "--pipeline-depth") {
+      int depth = 0;
+      if (!ParseInt(value, &depth) || depth < 0 || depth > FramePipeline::MAX_DEPTH) {
+        tgfx::PrintError("CommandLine::Apply() invalid pipeline depth: %s", value.c_str());
+        continue;
+      }
+      FramePipeline::SetDepth(depth);
+    } else if (name == "--threaded-submit") {
+      FramePipeline::SetThreadedSubmit(true);
+    } else if (name == "--validate" && !value.empty()) {
+      FrameValidator::EnableValidation(value);
+    } else if (name == "--record-goldens" && !value.empty()) {
+      FrameValidator::EnableRecording(value);
+    } else if (name == "--deterministic") {
+      AppHost::SetDeterministic(true);
+    } else if (name == "--mouse-path" && !value.empty()) {
+      AppHost::LoadMousePath(value);
+    } else if (name == "--replay" && !value.empty()) {
+      ReplayBench::SetCapturePath(value);
+    } else if (name == "--replay-frames") {
+      int count = 0;
+      if (!ParseInt(value, &count) || count < 0) {
+        tgfx::PrintError("CommandLine::Apply() invalid replay frame count: %s", value.c_str());
+        continue;
+      }
+      ReplayBench::SetReplayFrameCount(static_cast<size_t>(count));
+    } else if (name == "--scene" && !value.empty()) {
+      SceneBench::LoadScene(value);
+    } else if (name == "--dirty-fraction") {
+      float fraction = 0;
+      if (!ParseFloat(value, &fraction) || fraction < 0 || fraction > 1) {
+        tgfx::PrintError("CommandLine::Apply() invalid dirty fraction: %s", value.c_str());
+        continue;
+      }
+      PictureBench::SetDirtyFraction(fraction);
+    } else if (name == "--animated-fraction") {
+      float fraction = 0;
+      if (!ParseFloat(value, &fraction) || fraction < 0 || fraction > 1) {
+        tgfx::PrintError("CommandLine::Apply() invalid animated fraction: %s", value.c_str());
+        continue;
+      }
+      LayerTreeBench::SetAnimatedFraction(fraction);
+    } else if (name == "--tile-budget") {
+      int budget = 0;
+      if (!ParseInt(value, &budget) || budget <= 0) {
+        tgfx::PrintError("CommandLine::Apply() invalid tile budget: %s", value.c_str());
+        continue;
+      }
+      ScrollBench::SetTileBudget(budget);
+    } else if (name == "--card-elements") {
+      float fractions[5] = {};
+      if (!ParseFloats(value, fractions, 5)) {
+        tgfx::PrintError("CommandLine::Apply() invalid card elements: %s", value.c_str());
+        continue;
+      }
+      UISceneBench::SetElementFractions(fractions[0], fractions[1], fractions[2], fractions[3],
+                                        fractions[4]);
+    } else if (name == "--poster-size") {
+      int size = 0;
+      if (!ParseInt(value, &size) || size <= 0) {
+        tgfx::PrintError("CommandLine::Apply() invalid poster size: %s", value.c_str());
+        continue;
+      }
+      PosterBench::SetPosterSize(size);
+    } else if (name == "--frame-alloc-budget") {
+      int budget = 0;
+      if (!ParseInt(value, &budget) || budget < 0) {
+        tgfx::PrintError("CommandLine::Apply() invalid allocation budget: %s", value.c_str());
+        continue;
+      }
+      if (!MemoryTracker::IsEnabled()) {
+        tgfx::PrintError("CommandLine::Apply() --frame-alloc-budget needs BENCH_MEMORY_TRACKING!");
+        continue;
+      }
+      MemoryTracker::SetFrameAllocationBudget(budget);
+    } else if (name == "--soak") {
+      int minutes = 0;
+      if (!value.empty() && (!ParseInt(value, &minutes) || minutes < 0)) {
+        tgfx::PrintError("CommandLine::Apply() invalid soak duration: %s", value.c_str());
+        continue;
+      }
+      SoakRunner::Enable(minutes);
+    } else if (name == "--soak-interval") {
+      int seconds = 0;
+      if (!ParseInt(value, &seconds) || seconds <= 0) {
+        tgfx::PrintError("CommandLine::Apply() invalid soak interval: %s", value.c_str());
+        continue;
+      }
+      SoakRunner::SetInterval(seconds);
+    } else {
+      tgfx::PrintError("CommandLine::Apply() unknown option: %s", arg.c_str());
+    }
+  }
+}
+}  // namespace benchmark
@@ -0,0 +1,39 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * CommandLine applies the command line options of the native apps. See the Command Line Options
+ * section of README.md for the supported options.
+ */
+class CommandLine {
+ public:
+  /**
+   * Applies the given arguments, not including the program name. Unknown or invalid options are
+   * reported and ignored.
+   */
+  static void Apply(const std::vector<std::string>& args);
+};
+
+}  // namespace benchmark
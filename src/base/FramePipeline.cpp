@@ -0,0 +1,103 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FramePipeline.h"
+#include <algorithm>
+#include "tgfx/core/Clock.h"
+#include "tgfx/gpu/Device.h"
+
+namespace benchmark {
+static int PipelineDepth = 1;
+static bool ThreadedSubmit = false;
+
+void FramePipeline::SetDepth(int depth) {
+  PipelineDepth = std::max(0, std::min(depth, MAX_DEPTH));
+}
+
+int FramePipeline::Depth() {
+  return PipelineDepth;
+}
+
+void FramePipeline::SetThreadedSubmit(bool enabled) {
+#ifndef __EMSCRIPTEN__
+  ThreadedSubmit = enabled;
+#else
+  (void)enabled;
+#endif
+}
+
+FramePipeline::~FramePipeline() {
+  if (submitThread.joinable()) {
+    // A frame without context stops the submit thread.
+    submitQueue.push({});
+    submitThread.join();
+  }
+}
+
+void FramePipeline::submit(tgfx::Context* context, std::unique_ptr<tgfx::Recording> recording,
+                           int64_t inputTime) {
+  if (recording == nullptr) {
+    return;
+  }
+  pendingFrames.push_back({context, std::move(recording), inputTime});
+  auto depth = static_cast<size_t>(PipelineDepth);
+  while (pendingFrames.size() > depth) {
+    auto frame = std::move(pendingFrames.front());
+    pendingFrames.pop_front();
+    if (ThreadedSubmit && depth > 0) {
+      if (!submitThread.joinable()) {
+        submitThread = std::thread(&FramePipeline::submitLoop, this);
+      }
+      submitQueue.push(std::move(frame));
+    } else {
+      submitFrame(std::move(frame), depth == 0);
+    }
+  }
+}
+
+void FramePipeline::presented(AppHost* host) {
+  auto currentTime = tgfx::Clock::Now();
+  std::lock_guard<std::mutex> autoLock(locker);
+  for (auto inputTime : submittedInputTimes) {
+    host->recordLatency(currentTime - inputTime);
+  }
+  submittedInputTimes.clear();
+}
+
+void FramePipeline::submitFrame(Frame frame, bool syncCpu) {
+  frame.context->submit(std::move(frame.recording), syncCpu);
+  std::lock_guard<std::mutex> autoLock(locker);
+  submittedInputTimes.push_back(frame.inputTime);
+}
+
+void FramePipeline::submitLoop() {
+  while (true) {
+    auto frame = submitQueue.pop();
+    if (frame.context == nullptr) {
+      break;
+    }
+    // The render loop holds the context while recording, so this waits for it to finish the frame.
+    auto device = frame.context->device();
+    if (device->lockContext() == nullptr) {
+      continue;
+    }
+    submitFrame(std::move(frame), false);
+    device->unlock();
+  }
+}
+}  // namespace benchmark
@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "base/AppHost.h"
+#include "base/BlockingQueue.h"
+#include "tgfx/gpu/Context.h"
+
+namespace benchmark {
+
+/**
+ * FramePipeline holds the recordings flushed by a render loop and decides when to submit them to
+ * the GPU. With a depth of N, the recording of a frame is submitted N frames later, so the CPU can
+ * record up to N frames ahead of the GPU. A depth of 0 submits each frame right away and waits for
+ * the GPU to finish it. Deeper pipelines usually raise the throughput but also the latency from
+ * reading the input to presenting the frame, which is reported to the AppHost.
+ */
+class FramePipeline {
+ public:
+  static constexpr int MAX_DEPTH = 3;
+
+  /**
+   * Sets the number of frames in flight, clamped to [0, MAX_DEPTH]. The default value is 1.
+   */
+  static void SetDepth(int depth);
+
+  /**
+   * Returns the number of frames in flight.
+   */
+  static int Depth();
+
+  /**
+   * Sets whether the recordings are submitted on a separate thread. Ignored on the web platform,
+   * where the context can only be used on the main thread, and at depth 0. The default value is
+   * false.
+   */
+  static void SetThreadedSubmit(bool enabled);
+
+  FramePipeline() = default;
+
+  ~FramePipeline();
+
+  /**
+   * Takes the recording of the current frame and submits the ones that are more than Depth()
+   * frames old. The inputTime is the time when the frame started to read the input. Must be called
+   * with the context locked.
+   */
+  void submit(tgfx::Context* context, std::unique_ptr<tgfx::Recording> recording,
+              int64_t inputTime);
+
+  /**
+   * Reports the latency of each frame submitted since the last call to the host. Called after the
+   * window is presented.
+   */
+  void presented(AppHost* host);
+
+ private:
+  struct Frame {
+    tgfx::Context* context = nullptr;
+    std::unique_ptr<tgfx::Recording> recording = nullptr;
+    int64_t inputTime = 0;
+  };
+
+  void submitFrame(Frame frame, bool syncCpu);
+
+  void submitLoop();
+
+  std::deque<Frame> pendingFrames = {};
+  std::mutex locker = {};
+  std::vector<int64_t> submittedInputTimes = {};
+  BlockingQueue<Frame> submitQueue = {};
+  std::thread submitThread = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,202 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FrameValidator.h"
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include "tgfx/core/Surface.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+static constexpr int64_t SAMPLED_FRAMES[] = {10, 30, 60};
+static constexpr int THUMBNAIL_SIZE = 64;
+// The number of differing hash bits still treated as the same image.
+static constexpr int MAX_HASH_DISTANCE = 4;
+
+enum class ValidatorMode { Disabled, Validate, Record };
+
+static ValidatorMode Mode = ValidatorMode::Disabled;
+static std::string GoldenPath = "";
+static std::map<std::string, uint64_t> Goldens = {};
+
+static void LoadGoldens(const std::string& path) {
+  Goldens.clear();
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream stream(line);
+    std::string key;
+    std::string hash;
+    if (stream >> key >> hash) {
+      Goldens[key] = std::strtoull(hash.c_str(), nullptr, 16);
+    }
+  }
+}
+
+static void SaveGoldens(const std::string& path) {
+  std::ofstream file(path, std::ios::trunc);
+  if (!file) {
+    tgfx::PrintError("FrameValidator: failed to write the golden file %s!", path.c_str());
+    return;
+  }
+  file << "# Frame hashes recorded by FrameValidator, one \"key hash\" pair per line.\n";
+  for (auto& item : Goldens) {
+    char hash[17] = {};
+    snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(item.second));
+    file << item.first << " " << hash << "\n";
+  }
+}
+
+static int HashDistance(uint64_t a, uint64_t b) {
+  auto bits = a ^ b;
+  int count = 0;
+  while (bits != 0) {
+    bits &= bits - 1;
+    count++;
+  }
+  return count;
+}
+
+// Computes a difference hash: the 64x64 thumbnail is averaged into 9x8 gray cells, and each bit
+// tells whether a cell is brighter than its right neighbor.
+static uint64_t ComputeHash(const uint8_t* pixels) {
+  float cells[8][9] = {};
+  for (int row = 0; row < 8; row++) {
+    for (int column = 0; column < 9; column++) {
+      auto top = row * THUMBNAIL_SIZE / 8;
+      auto bottom = (row + 1) * THUMBNAIL_SIZE / 8;
+      auto left = column * THUMBNAIL_SIZE / 9;
+      auto right = (column + 1) * THUMBNAIL_SIZE / 9;
+      float sum = 0;
+      for (int y = top; y < bottom; y++) {
+        for (int x = left; x < right; x++) {
+          auto pixel = pixels + (y * THUMBNAIL_SIZE + x) * 4;
+          sum += 0.299f * pixel[0] + 0.587f * pixel[1] + 0.114f * pixel[2];
+        }
+      }
+      cells[row][column] = sum / static_cast<float>((bottom - top) * (right - left));
+    }
+  }
+  uint64_t hash = 0;
+  for (int row = 0; row < 8; row++) {
+    for (int column = 0; column < 8; column++) {
+      hash = hash << 1 | (cells[row][column] > cells[row][column + 1] ? 1u : 0u);
+    }
+  }
+  return hash;
+}
+
+static bool HashCanvas(tgfx::Canvas* canvas, uint64_t* hash) {
+  auto surface = canvas->getSurface();
+  if (surface == nullptr || surface->getContext() == nullptr) {
+    return false;
+  }
+  auto snapshot = surface->makeImageSnapshot();
+  if (snapshot == nullptr) {
+    return false;
+  }
+  // Mipmaps average the whole frame into the thumbnail instead of sampling a few pixels of it.
+  snapshot = snapshot->makeMipmapped(true);
+  auto thumbnail = tgfx::Surface::Make(surface->getContext(), THUMBNAIL_SIZE, THUMBNAIL_SIZE);
+  if (thumbnail == nullptr) {
+    return false;
+  }
+  auto size = static_cast<float>(THUMBNAIL_SIZE);
+  thumbnail->getCanvas()->drawImageRect(
+      snapshot, tgfx::Rect::MakeWH(size, size),
+      tgfx::SamplingOptions(tgfx::FilterMode::Linear, tgfx::MipmapMode::Linear));
+  uint8_t pixels[THUMBNAIL_SIZE * THUMBNAIL_SIZE * 4] = {};
+  auto info = tgfx::ImageInfo::Make(THUMBNAIL_SIZE, THUMBNAIL_SIZE, tgfx::ColorType::RGBA_8888);
+  if (!thumbnail->readPixels(info, pixels)) {
+    return false;
+  }
+  *hash = ComputeHash(pixels);
+  return true;
+}
+
+void FrameValidator::EnableValidation(const std::string& goldenPath) {
+  Mode = ValidatorMode::Validate;
+  GoldenPath = goldenPath;
+  LoadGoldens(goldenPath);
+  if (Goldens.empty()) {
+    tgfx::PrintError("FrameValidator: no golden hashes found in %s!", goldenPath.c_str());
+  }
+}
+
+void FrameValidator::EnableRecording(const std::string& goldenPath) {
+  Mode = ValidatorMode::Record;
+  GoldenPath = goldenPath;
+  LoadGoldens(goldenPath);
+}
+
+bool FrameValidator::IsEnabled() {
+  return Mode != ValidatorMode::Disabled;
+}
+
+bool FrameValidator::IsSampledFrame(int64_t frameIndex) {
+  for (auto sampledFrame : SAMPLED_FRAMES) {
+    if (frameIndex == sampledFrame) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int64_t FrameValidator::LastSampledFrame() {
+  return SAMPLED_FRAMES[sizeof(SAMPLED_FRAMES) / sizeof(SAMPLED_FRAMES[0]) - 1];
+}
+
+void FrameValidator::Check(const std::string& key, tgfx::Canvas* canvas) {
+  if (Mode == ValidatorMode::Disabled) {
+    return;
+  }
+  uint64_t hash = 0;
+  if (!HashCanvas(canvas, &hash)) {
+    tgfx::PrintError("FrameValidator: failed to read back the frame of %s!", key.c_str());
+    return;
+  }
+  if (Mode == ValidatorMode::Record) {
+    auto result = Goldens.find(key);
+    if (result == Goldens.end() || result->second != hash) {
+      Goldens[key] = hash;
+      SaveGoldens(GoldenPath);
+    }
+    return;
+  }
+  auto result = Goldens.find(key);
+  if (result == Goldens.end()) {
+    tgfx::PrintWarn("FrameValidator: no golden hash for %s, skipped.", key.c_str());
+    return;
+  }
+  auto distance = HashDistance(result->second, hash);
+  if (distance <= MAX_HASH_DISTANCE) {
+    return;
+  }
+  tgfx::PrintError("FrameValidator: %s expected %016llx but got %016llx, %d bits differ!",
+                   key.c_str(), static_cast<unsigned long long>(result->second),
+                   static_cast<unsigned long long>(hash), distance);
+#ifndef __EMSCRIPTEN__
+  std::exit(EXIT_FAILURE);
+#endif
+}
+}  // namespace benchmark
@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "tgfx/core/Canvas.h"
+
+namespace benchmark {
+
+/**
+ * FrameValidator guards perf runs against benches that got faster only because they stopped
+ * drawing. When enabled, benches hash their frames at a few fixed frame indices after a reset and
+ * compare the hashes against goldens stored in a text file, one "key hash" pair per line. The hash
+ * is a 64-bit difference hash computed from a 64x64 GPU downscale of the frame, so it costs one
+ * small readback per sampled frame and tolerates tiny rasterization differences.
+ */
+class FrameValidator {
+ public:
+  /**
+   * Enables validating the sampled frames against the golden file at the given path. A mismatch
+   * is reported and, on native platforms, exits the process with a failure code.
+   */
+  static void EnableValidation(const std::string& goldenPath);
+
+  /**
+   * Enables recording the hashes of the sampled frames into the golden file at the given path,
+   * replacing the existing hashes with the same keys.
+   */
+  static void EnableRecording(const std::string& goldenPath);
+
+  /**
+   * Returns true if validation or recording is enabled.
+   */
+  static bool IsEnabled();
+
+  /**
+   * Returns true if the frame with the given index after a reset is hashed. The first frame after
+   * a reset has the index 1.
+   */
+  static bool IsSampledFrame(int64_t frameIndex);
+
+  /**
+   * Returns the index of the last sampled frame. Benches keep their content deterministic until
+   * this frame.
+   */
+  static int64_t LastSampledFrame();
+
+  /**
+   * Hashes the current content of the canvas surface and validates or records it under the given
+   * key, which should identify the bench, its configuration and the frame index.
+   */
+  static void Check(const std::string& key, tgfx::Canvas* canvas);
+};
+
+}  // namespace benchmark
@@ -0,0 +1,291 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "JSONValue.h"
+#include <cstdlib>
+
+namespace benchmark {
+// Limits the nesting depth, so that malformed input cannot exhaust the stack.
+static constexpr int MAX_DEPTH = 64;
+
+class JSONParser {
+ public:
+  explicit JSONParser(const std::string& text) : text(text) {
+  }
+
+  bool parse(JSONValue* value, std::string* error) {
+    skipSpaces();
+    if (!parseValue(value, 0)) {
+      *error = message;
+      return false;
+    }
+    skipSpaces();
+    if (position < text.size()) {
+      *error = errorAt("unexpected trailing characters");
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  const std::string& text;
+  size_t position = 0;
+  std::string message = "";
+
+  std::string errorAt(const std::string& problem) const {
+    size_t line = 1;
+    size_t column = 1;
+    for (size_t i = 0; i < position && i < text.size(); i++) {
+      if (text[i] == '\n') {
+        line++;
+        column = 1;
+      } else {
+        column++;
+      }
+    }
+    return problem + " at line " + std::to_string(line) + ", column " + std::to_string(column);
+  }
+
+  bool fail(const std::string& problem) {
+    message = errorAt(problem);
+    return false;
+  }
+
+  void skipSpaces() {
+    while (position < text.size() && (text[position] == ' ' || text[position] == '\t' ||
+                                      text[position] == '\n' || text[position] == '\r')) {
+      position++;
+    }
+  }
+
+  bool consume(const char* literal) {
+    auto length = std::char_traits<char>::length(literal);
+    if (text.compare(position, length, literal) != 0) {
+      return false;
+    }
+    position += length;
+    return true;
+  }
+
+  bool parseValue(JSONValue* value, int depth) {
+    if (depth > MAX_DEPTH) {
+      return fail("nesting too deep");
+    }
+    if (position >= text.size()) {
+      return fail("unexpected end of input");
+    }
+    auto c = text[position];
+    if (c == '{') {
+      return parseObject(value, depth);
+    }
+    if (c == '[') {
+      return parseArray(value, depth);
+    }
+    if (c == '"') {
+      value->_type = JSONType::String;
+      return parseString(&value->stringValue);
+    }
+    if (consume("true")) {
+      value->_type = JSONType::Bool;
+      value->boolValue = true;
+      return true;
+    }
+    if (consume("false")) {
+      value->_type = JSONType::Bool;
+      value->boolValue = false;
+      return true;
+    }
+    if (consume("null")) {
+      value->_type = JSONType::Null;
+      return true;
+    }
+    return parseNumber(value);
+  }
+
+  bool parseNumber(JSONValue* value) {
+    auto start = text.c_str() + position;
+    char* end = nullptr;
+    auto number = std::strtod(start, &end);
+    if (end == start) {
+      return fail("unexpected character");
+    }
+    position += static_cast<size_t>(end - start);
+    value->_type = JSONType::Number;
+    value->numberValue = number;
+    return true;
+  }
+
+  bool parseString(std::string* result) {
+    // Skips the opening quote.
+    position++;
+    result->clear();
+    while (position < text.size()) {
+      auto c = text[position++];
+      if (c == '"') {
+        return true;
+      }
+      if (c != '\\') {
+        result->push_back(c);
+        continue;
+      }
+      if (position >= text.size()) {
+        break;
+      }
+      auto escaped = text[position++];
+      switch (escaped) {
+        case 'n':
+          result->push_back('\n');
+          break;
+        case 't':
+          result->push_back('\t');
+          break;
+        case 'r':
+          result->push_back('\r');
+          break;
+        case 'b':
+          result->push_back('\b');
+          break;
+        case 'f':
+          result->push_back('\f');
+          break;
+        case 'u':
+          return fail("\\u escapes are not supported");
+        default:
+          result->push_back(escaped);
+          break;
+      }
+    }
+    return fail("unterminated string");
+  }
+
+  bool parseArray(JSONValue* value, int depth) {
+    // Skips the opening bracket.
+    position++;
+    value->_type = JSONType::Array;
+    skipSpaces();
+    if (consume("]")) {
+      return true;
+    }
+    while (true) {
+      value->values.emplace_back();
+      skipSpaces();
+      if (!parseValue(&value->values.back(), depth + 1)) {
+        return false;
+      }
+      skipSpaces();
+      if (consume("]")) {
+        return true;
+      }
+      if (!consume(",")) {
+        return fail("expected ',' or ']'");
+      }
+    }
+  }
+
+  bool parseObject(JSONValue* value, int depth) {
+    // Skips the opening brace.
+    position++;
+    value->_type = JSONType::Object;
+    skipSpaces();
+    if (consume("}")) {
+      return true;
+    }
+    while (true) {
+      skipSpaces();
+      if (position >= text.size() || text[position] != '"') {
+        return fail("expected a key");
+      }
+      value->keys.emplace_back();
+      if (!parseString(&value->keys.back())) {
+        return false;
+      }
+      skipSpaces();
+      if (!consume(":")) {
+        return fail("expected ':'");
+      }
+      skipSpaces();
+      value->values.emplace_back();
+      if (!parseValue(&value->values.back(), depth + 1)) {
+        return false;
+      }
+      skipSpaces();
+      if (consume("}")) {
+        return true;
+      }
+      if (!consume(",")) {
+        return fail("expected ',' or '}'");
+      }
+    }
+  }
+};
+
+static const JSONValue& NullValue() {
+  static const JSONValue value = {};
+  return value;
+}
+
+bool JSONValue::Parse(const std::string& text, JSONValue* value, std::string* error) {
+  *value = {};
+  JSONParser parser(text);
+  return parser.parse(value, error);
+}
+
+bool JSONValue::asBool(bool defaultValue) const {
+  return _type == JSONType::Bool ? boolValue : defaultValue;
+}
+
+double JSONValue::asNumber(double defaultValue) const {
+  return _type == JSONType::Number ? numberValue : defaultValue;
+}
+
+float JSONValue::asFloat(float defaultValue) const {
+  return _type == JSONType::Number ? static_cast<float>(numberValue) : defaultValue;
+}
+
+std::string JSONValue::asString(const std::string& defaultValue) const {
+  return _type == JSONType::String ? stringValue : defaultValue;
+}
+
+const JSONValue& JSONValue::at(size_t index) const {
+  if (_type != JSONType::Array || index >= values.size()) {
+    return NullValue();
+  }
+  return values[index];
+}
+
+const JSONValue& JSONValue::get(const std::string& key) const {
+  if (_type != JSONType::Object) {
+    return NullValue();
+  }
+  for (size_t i = 0; i < keys.size(); i++) {
+    if (keys[i] == key) {
+      return values[i];
+    }
+  }
+  return NullValue();
+}
+
+const std::string& JSONValue::keyAt(size_t index) const {
+  static const std::string empty = "";
+  if (_type != JSONType::Object || index >= keys.size()) {
+    return empty;
+  }
+  return keys[index];
+}
+
+}  // namespace benchmark
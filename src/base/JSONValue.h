@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+enum class JSONType { Null, Bool, Number, String, Array, Object };
+
+/**
+ * JSONValue is a parsed JSON document node. It covers what scene descriptions need: objects keep
+ * the order of their keys, numbers are doubles, and string escapes other than \uXXXX are decoded.
+ * Accessors never fail: reading a missing key or a value of the wrong type returns the given
+ * default, so callers can treat every field as optional.
+ */
+class JSONValue {
+ public:
+  /**
+   * Parses the given JSON text into the value. Returns false and describes the first problem in
+   * the error string if the text is not valid JSON.
+   */
+  static bool Parse(const std::string& text, JSONValue* value, std::string* error);
+
+  JSONType type() const {
+    return _type;
+  }
+
+  bool isNull() const {
+    return _type == JSONType::Null;
+  }
+
+  bool isArray() const {
+    return _type == JSONType::Array;
+  }
+
+  bool isObject() const {
+    return _type == JSONType::Object;
+  }
+
+  /**
+   * Returns the boolean value, or the default if this is not a boolean.
+   */
+  bool asBool(bool defaultValue = false) const;
+
+  /**
+   * Returns the number value, or the default if this is not a number.
+   */
+  double asNumber(double defaultValue = 0) const;
+
+  /**
+   * Returns the number value as a float, or the default if this is not a number.
+   */
+  float asFloat(float defaultValue = 0) const;
+
+  /**
+   * Returns the string value, or the default if this is not a string.
+   */
+  std::string asString(const std::string& defaultValue = "") const;
+
+  /**
+   * Returns the number of elements of an array or members of an object, or 0 otherwise.
+   */
+  size_t size() const {
+    return values.size();
+  }
+
+  /**
+   * Returns the element at the given index of an array, or a null value if there is none.
+   */
+  const JSONValue& at(size_t index) const;
+
+  /**
+   * Returns the member with the given key of an object, or a null value if there is none.
+   */
+  const JSONValue& get(const std::string& key) const;
+
+  /**
+   * Returns the key of the member at the given index of an object, or an empty string.
+   */
+  const std::string& keyAt(size_t index) const;
+
+ private:
+  friend class JSONParser;
+
+  JSONType _type = JSONType::Null;
+  bool boolValue = false;
+  double numberValue = 0;
+  std::string stringValue = "";
+  // The elements of an array or the member values of an object, parallel to keys for objects.
+  std::vector<JSONValue> values = {};
+  std::vector<std::string> keys = {};
+};
+
+}  // namespace benchmark
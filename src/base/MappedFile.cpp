@@ -0,0 +1,117 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MappedFile.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+MappedFile::~MappedFile() {
+  close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& path) {
+  close();
+  auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    tgfx::PrintError("MappedFile::open() failed to open %s!", path.c_str());
+    return false;
+  }
+  LARGE_INTEGER fileSize = {};
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+    CloseHandle(file);
+    tgfx::PrintError("MappedFile::open() %s is empty!", path.c_str());
+    return false;
+  }
+  auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  auto view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+  if (view == nullptr) {
+    if (mapping) {
+      CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    tgfx::PrintError("MappedFile::open() failed to map %s!", path.c_str());
+    return false;
+  }
+  fileHandle = file;
+  mappingHandle = mapping;
+  _bytes = static_cast<const uint8_t*>(view);
+  _size = static_cast<size_t>(fileSize.QuadPart);
+  return true;
+}
+
+void MappedFile::close() {
+  if (_bytes != nullptr) {
+    UnmapViewOfFile(_bytes);
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+  }
+  _bytes = nullptr;
+  _size = 0;
+  fileHandle = nullptr;
+  mappingHandle = nullptr;
+}
+
+#else
+
+bool MappedFile::open(const std::string& path) {
+  close();
+  auto file = ::open(path.c_str(), O_RDONLY);
+  if (file < 0) {
+    tgfx::PrintError("MappedFile::open() failed to open %s!", path.c_str());
+    return false;
+  }
+  struct stat fileStat = {};
+  if (fstat(file, &fileStat) != 0 || fileStat.st_size <= 0) {
+    ::close(file);
+    tgfx::PrintError("MappedFile::open() %s is empty!", path.c_str());
+    return false;
+  }
+  auto size = static_cast<size_t>(fileStat.st_size);
+  auto view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+  // The mapping stays valid after the descriptor is closed.
+  ::close(file);
+  if (view == MAP_FAILED) {
+    tgfx::PrintError("MappedFile::open() failed to map %s!", path.c_str());
+    return false;
+  }
+  _bytes = static_cast<const uint8_t*>(view);
+  _size = size;
+  return true;
+}
+
+void MappedFile::close() {
+  if (_bytes != nullptr) {
+    munmap(const_cast<uint8_t*>(_bytes), _size);
+  }
+  _bytes = nullptr;
+  _size = 0;
+}
+
+#endif
+}  // namespace benchmark
@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace benchmark {
+
+/**
+ * MappedFile maps a file into memory read-only, so its content is paged in by the OS on demand and
+ * can be dropped again under memory pressure instead of being copied onto the heap.
+ */
+class MappedFile {
+ public:
+  MappedFile() = default;
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * Maps the file at the given path, unmapping the current one. Returns false if the file cannot
+   * be opened or is empty.
+   */
+  bool open(const std::string& path);
+
+  /**
+   * Unmaps the current file.
+   */
+  void close();
+
+  /**
+   * Returns the mapped bytes, or nullptr if no file is mapped.
+   */
+  const uint8_t* bytes() const {
+    return _bytes;
+  }
+
+  /**
+   * Returns the size of the mapped file in bytes.
+   */
+  size_t size() const {
+    return _size;
+  }
+
+ private:
+  const uint8_t* _bytes = nullptr;
+  size_t _size = 0;
+#ifdef _WIN32
+  void* fileHandle = nullptr;
+  void* mappingHandle = nullptr;
+#endif
+};
+
+}  // namespace benchmark
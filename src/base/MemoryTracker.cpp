@@ -0,0 +1,355 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "base/Bench.h"
+#include "tgfx/platform/Print.h"
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#include <malloc/malloc.h>
+#elif defined(_WIN32)
+#include <malloc.h>
+#include <windows.h>
+// psapi.h needs the types declared in windows.h, so it must stay after it.
+#include <psapi.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace benchmark {
+// The counters are updated by every thread, so they are lock-free atomics that need no allocation.
+static std::atomic<uint64_t> AllocationCount = {0};
+static std::atomic<uint64_t> AllocatedBytes = {0};
+static std::atomic<int64_t> LiveHeapBytes = {0};
+static std::atomic<int64_t> PeakLiveBytes = {0};
+
+static int64_t FrameAllocationBudget = -1;
+static const Bench* SteadyBench = nullptr;
+static uint64_t PhaseStartCount = 0;
+static uint64_t FrameStartBytes = 0;
+static uint64_t FrameAllocations[FRAME_PHASE_COUNT] = {};
+static uint64_t SampleAllocations[FRAME_PHASE_COUNT] = {};
+static uint64_t SampleBytes = 0;
+static uint64_t SampleFrames = 0;
+
+#ifdef BENCH_MEMORY_TRACKING
+static size_t UsableSize(void* pointer) {
+#if defined(__APPLE__)
+  return malloc_size(pointer);
+#elif defined(_WIN32)
+  return _msize(pointer);
+#else
+  return malloc_usable_size(pointer);
+#endif
+}
+
+static void TrackAllocation(size_t size) {
+  AllocationCount.fetch_add(1, std::memory_order_relaxed);
+  AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  auto live = LiveHeapBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) +
+              static_cast<int64_t>(size);
+  auto peak = PeakLiveBytes.load(std::memory_order_relaxed);
+  while (live > peak && !PeakLiveBytes.compare_exchange_weak(peak, live)) {
+  }
+}
+
+static void TrackFree(size_t size) {
+  LiveHeapBytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+}
+
+static void* Allocate(size_t size) {
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+    auto pointer = std::malloc(size);
+    if (pointer != nullptr) {
+      TrackAllocation(UsableSize(pointer));
+      return pointer;
+    }
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+static void Free(void* pointer) {
+  if (pointer == nullptr) {
+    return;
+  }
+  TrackFree(UsableSize(pointer));
+  std::free(pointer);
+}
+
+static void* AllocateAligned(size_t size, std::align_val_t alignment) {
+  auto align = std::max(static_cast<size_t>(alignment), sizeof(void*));
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+#ifdef _WIN32
+    auto pointer = _aligned_malloc(size, align);
+    if (pointer != nullptr) {
+      TrackAllocation(_aligned_msize(pointer, align, 0));
+      return pointer;
+    }
+#else
+    void* pointer = nullptr;
+    if (posix_memalign(&pointer, align, size) == 0) {
+      TrackAllocation(UsableSize(pointer));
+      return pointer;
+    }
+#endif
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+static void FreeAligned(void* pointer, std::align_val_t alignment) {
+  if (pointer == nullptr) {
+    return;
+  }
+#ifdef _WIN32
+  auto align = std::max(static_cast<size_t>(alignment), sizeof(void*));
+  TrackFree(_aligned_msize(pointer, align, 0));
+  _aligned_free(pointer);
+#else
+  (void)alignment;
+  Free(pointer);
+#endif
+}
+#endif
+
+void MemoryTracker::ReadResidentSize(size_t* current, size_t* peak) {
+#if defined(__APPLE__)
+  mach_task_basic_info info = {};
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info),
+                &count) == KERN_SUCCESS) {
+    *current = info.resident_size;
+    *peak = info.resident_size_max;
+  }
+#elif defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters = {};
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    *current = counters.WorkingSetSize;
+    *peak = counters.PeakWorkingSetSize;
+  }
+#else
+  // The resident size is only sampled on the native desktop platforms.
+  (void)current;
+  (void)peak;
+#endif
+}
+
+bool MemoryTracker::IsEnabled() {
+#ifdef BENCH_MEMORY_TRACKING
+  return true;
+#else
+  return false;
+#endif
+}
+
+void MemoryTracker::SetFrameAllocationBudget(int64_t budget) {
+  FrameAllocationBudget = budget;
+}
+
+void MemoryTracker::BeginFrame() {
+  if (!IsEnabled()) {
+    return;
+  }
+  SteadyBench = nullptr;
+  PhaseStartCount = AllocationCount.load(std::memory_order_relaxed);
+  FrameStartBytes = AllocatedBytes.load(std::memory_order_relaxed);
+  for (auto& count : FrameAllocations) {
+    count = 0;
+  }
+}
+
+void MemoryTracker::EndPhase(FramePhase phase) {
+  if (!IsEnabled()) {
+    return;
+  }
+  auto count = AllocationCount.load(std::memory_order_relaxed);
+  FrameAllocations[static_cast<size_t>(phase)] += count - PhaseStartCount;
+  PhaseStartCount = count;
+}
+
+void MemoryTracker::MarkSteadyFrame(const Bench* bench) {
+  SteadyBench = bench;
+}
+
+void MemoryTracker::EndFrame() {
+  if (!IsEnabled()) {
+    return;
+  }
+  uint64_t total = 0;
+  for (size_t i = 0; i < FRAME_PHASE_COUNT; i++) {
+    SampleAllocations[i] += FrameAllocations[i];
+    total += FrameAllocations[i];
+  }
+  SampleBytes += AllocatedBytes.load(std::memory_order_relaxed) - FrameStartBytes;
+  SampleFrames++;
+  if (SteadyBench == nullptr || FrameAllocationBudget < 0 ||
+      total <= static_cast<uint64_t>(FrameAllocationBudget)) {
+    return;
+  }
+  tgfx::PrintError("MemoryTracker: %s made %llu allocations (draw %llu, flush %llu, submit %llu)"
+                   " in a steady-state frame, over the budget of %lld!",
+                   SteadyBench->name().c_str(), static_cast<unsigned long long>(total),
+                   static_cast<unsigned long long>(FrameAllocations[0]),
+                   static_cast<unsigned long long>(FrameAllocations[1]),
+                   static_cast<unsigned long long>(FrameAllocations[2]),
+                   static_cast<long long>(FrameAllocationBudget));
+#ifndef __EMSCRIPTEN__
+  std::exit(EXIT_FAILURE);
+#endif
+}
+
+size_t MemoryTracker::LiveBytes() {
+  return static_cast<size_t>(std::max(LiveHeapBytes.load(), static_cast<int64_t>(0)));
+}
+
+MemoryStats MemoryTracker::Sample() {
+  MemoryStats stats = {};
+  if (!IsEnabled()) {
+    return stats;
+  }
+  if (SampleFrames > 0) {
+    auto frames = static_cast<float>(SampleFrames);
+    for (size_t i = 0; i < FRAME_PHASE_COUNT; i++) {
+      stats.allocations[i] = static_cast<float>(SampleAllocations[i]) / frames;
+      SampleAllocations[i] = 0;
+    }
+    stats.allocatedBytes = static_cast<float>(SampleBytes) / frames;
+  }
+  SampleBytes = 0;
+  SampleFrames = 0;
+  stats.liveBytes = LiveBytes();
+  stats.peakLiveBytes = static_cast<size_t>(PeakLiveBytes.load());
+  ReadResidentSize(&stats.residentBytes, &stats.peakResidentBytes);
+  return stats;
+}
+}  // namespace benchmark
+
+#ifdef BENCH_MEMORY_TRACKING
+void* operator new(size_t size) {
+  return benchmark::Allocate(size);
+}
+
+void* operator new[](size_t size) {
+  return benchmark::Allocate(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return benchmark::Allocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return benchmark::Allocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  return benchmark::AllocateAligned(size, alignment);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+  return benchmark::AllocateAligned(size, alignment);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  try {
+    return benchmark::AllocateAligned(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  try {
+    return benchmark::AllocateAligned(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void operator delete(void* pointer) noexcept {
+  benchmark::Free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  benchmark::Free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  benchmark::Free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+  benchmark::Free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  benchmark::Free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  benchmark::Free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept {
+  benchmark::FreeAligned(pointer, alignment);
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept {
+  benchmark::FreeAligned(pointer, alignment);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t alignment) noexcept {
+  benchmark::FreeAligned(pointer, alignment);
+}
+
+void operator delete[](void* pointer, size_t, std::align_val_t alignment) noexcept {
+  benchmark::FreeAligned(pointer, alignment);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  benchmark::FreeAligned(pointer, alignment);
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  benchmark::FreeAligned(pointer, alignment);
+}
+#endif
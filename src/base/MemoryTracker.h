@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace benchmark {
+class Bench;
+
+/**
+ * The phases of a frame in the order the render loop runs them. Draw covers acquiring the surface
+ * and recording the bench, Flush covers flushing the context, and Submit covers submitting the
+ * recording and presenting the window.
+ */
+enum class FramePhase { Draw, Flush, Submit };
+
+static constexpr size_t FRAME_PHASE_COUNT = 3;
+
+/**
+ * The memory usage reported by MemoryTracker::Sample().
+ */
+struct MemoryStats {
+  // The average number of allocations per frame in each FramePhase since the previous sample.
+  float allocations[FRAME_PHASE_COUNT] = {};
+  // The average number of bytes allocated per frame since the previous sample.
+  float allocatedBytes = 0;
+  // The heap bytes allocated at the end of the last frame, and their peak since launch.
+  size_t liveBytes = 0;
+  size_t peakLiveBytes = 0;
+  // The resident set size of the process, and its peak since launch.
+  size_t residentBytes = 0;
+  size_t peakResidentBytes = 0;
+};
+
+/**
+ * MemoryTracker counts the heap allocations of each frame, so per-frame churn and memory growth
+ * show up next to the frame times. It is compiled in with the BENCH_MEMORY_TRACKING CMake option,
+ * which replaces the global operator new and delete with versions that count the allocations and
+ * bytes of every thread, including those made by tgfx. Otherwise all methods do nothing. The render
+ * loop brackets each frame with BeginFrame() and EndFrame() and marks the end of each phase.
+ */
+class MemoryTracker {
+ public:
+  /**
+   * Returns true if the allocation counting is compiled in.
+   */
+  static bool IsEnabled();
+
+  /**
+   * Sets the maximum number of allocations allowed in a steady-state frame. A frame over the budget
+   * is reported and, on native platforms, exits the process with a failure code. A negative value
+   * disables the check, which is the default.
+   */
+  static void SetFrameAllocationBudget(int64_t budget);
+
+  /**
+   * Starts counting the allocations of a new frame.
+   */
+  static void BeginFrame();
+
+  /**
+   * Attributes the allocations since the end of the previous phase to the given phase.
+   */
+  static void EndPhase(FramePhase phase);
+
+  /**
+   * Marks the current frame as a steady-state frame of the given bench, which draws the same
+   * content as its previous frame and is therefore checked against the allocation budget.
+   */
+  static void MarkSteadyFrame(const Bench* bench);
+
+  /**
+   * Finishes the current frame and checks it against the allocation budget.
+   */
+  static void EndFrame();
+
+  /**
+   * Returns the memory usage averaged over the frames since the previous call.
+   */
+  static MemoryStats Sample();
+
+  /**
+   * Returns the heap bytes currently allocated, or 0 if the allocation counting is not compiled in.
+   */
+  static size_t LiveBytes();
+
+  /**
+   * Reads the current and peak resident set size of the process in bytes. Works without the
+   * allocation counting, but leaves the values untouched on platforms other than macOS and Windows.
+   */
+  static void ReadResidentSize(size_t* current, size_t* peak);
+};
+
+}  // namespace benchmark
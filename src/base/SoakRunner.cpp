@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SoakRunner.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include "base/Bench.h"
+#include "base/MemoryTracker.h"
+#include "tgfx/core/Clock.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+// About ten seconds per phase at 60 fps, with the frames reset at the halfway point.
+static constexpr int64_t SOAK_PHASE_FRAMES = 600;
+// The frames after each reset that are left out of the percentiles, while the bench ramps up.
+static constexpr int64_t SOAK_WARM_UP_FRAMES = 60;
+static constexpr float SOAK_WINDOW_SCALES[] = {1.f, 0.75f, 0.5f, 0.9f};
+static constexpr size_t SOAK_SCALE_COUNT =
+    sizeof(SOAK_WINDOW_SCALES) / sizeof(SOAK_WINDOW_SCALES[0]);
+// A phase drifts if its median frame time exceeds the baseline by both of these margins, or if its
+// particle count falls short of the baseline by the ratio.
+static constexpr float SOAK_DRIFT_RATIO = 0.25f;
+static constexpr int64_t SOAK_DRIFT_MIN_TIME = 500;
+// Memory grows if it has not dropped over this many intervals and rose by more than the margin.
+static constexpr size_t SOAK_GROWTH_INTERVALS = 10;
+static constexpr size_t SOAK_GROWTH_MIN_BYTES = 8 * 1024 * 1024;
+static constexpr float BYTES_PER_MB = 1024.f * 1024.f;
+
+static bool SoakEnabled = false;
+static int64_t SoakDuration = 0;
+static int64_t SoakInterval = 60000000;
+
+static int64_t Percentile(std::vector<int64_t>* values, float fraction) {
+  if (values->empty()) {
+    return 0;
+  }
+  auto index = static_cast<size_t>(static_cast<float>(values->size() - 1) * fraction);
+  std::nth_element(values->begin(), values->begin() + static_cast<std::ptrdiff_t>(index),
+                   values->end());
+  return (*values)[index];
+}
+
+static float ToMilliseconds(int64_t time) {
+  return static_cast<float>(time) / 1000.f;
+}
+
+static float ToMB(size_t bytes) {
+  return static_cast<float>(bytes) / BYTES_PER_MB;
+}
+
+void SoakRunner::Enable(int64_t durationMinutes) {
+  SoakEnabled = true;
+  SoakDuration = std::max(durationMinutes, static_cast<int64_t>(0)) * 60000000;
+}
+
+bool SoakRunner::IsEnabled() {
+  return SoakEnabled;
+}
+
+void SoakRunner::SetInterval(int64_t seconds) {
+  SoakInterval = std::max(seconds, static_cast<int64_t>(1)) * 1000000;
+}
+
+int SoakRunner::benchIndex() const {
+  return static_cast<int>(phaseIndex % static_cast<size_t>(Bench::Count()));
+}
+
+float SoakRunner::windowScale() const {
+  return SOAK_WINDOW_SCALES[scaleIndex()];
+}
+
+size_t SoakRunner::scaleIndex() const {
+  // Shifts the scale by one step after each round of benches, so every bench meets every scale.
+  auto round = phaseIndex / static_cast<size_t>(Bench::Count());
+  return (static_cast<size_t>(benchIndex()) + round) % SOAK_SCALE_COUNT;
+}
+
+bool SoakRunner::isWarmUpFrame() const {
+  auto framesSinceReset = phaseFrames > SOAK_PHASE_FRAMES / 2 ? phaseFrames - SOAK_PHASE_FRAMES / 2
+                                                               : phaseFrames;
+  return framesSinceReset <= SOAK_WARM_UP_FRAMES;
+}
+
+bool SoakRunner::recordFrame(AppHost* host, int64_t drawTime) {
+  auto currentTime = tgfx::Clock::Now();
+  if (startTime < 0) {
+    startTime = currentTime;
+    intervalStartTime = currentTime;
+    phaseFrameTimes.reserve(static_cast<size_t>(SOAK_PHASE_FRAMES));
+  }
+  phaseFrames++;
+  if (!isWarmUpFrame()) {
+    phaseFrameTimes.push_back(drawTime);
+    intervalFrameTimes.push_back(drawTime);
+  }
+  intervalPeakGPUBytes = std::max(intervalPeakGPUBytes, host->gpuMemoryUsage());
+  if (currentTime - intervalStartTime >= SoakInterval) {
+    finishInterval(currentTime);
+  }
+  if (SoakDuration > 0 && currentTime - startTime >= SoakDuration) {
+    finish(currentTime);
+  }
+  if (phaseFrames == SOAK_PHASE_FRAMES / 2) {
+    host->resetFrames();
+  }
+  if (phaseFrames < SOAK_PHASE_FRAMES) {
+    return false;
+  }
+  // The count was reached in the frames since the last reset, or is 0 if the bench has none.
+  finishPhase(Bench::GetByIndex(benchIndex())->currentDrawCount());
+  phaseIndex++;
+  phaseFrames = 0;
+  host->resetFrames();
+  return true;
+}
+
+void SoakRunner::finishPhase(size_t drawCount) {
+  auto index = static_cast<size_t>(benchIndex());
+  auto scale = windowScale();
+  auto median = Percentile(&phaseFrameTimes, 0.5f);
+  auto p99 = Percentile(&phaseFrameTimes, 0.99f);
+  phaseFrameTimes.clear();
+  auto name = Bench::GetByIndex(benchIndex())->name();
+  auto key = index * SOAK_SCALE_COUNT + scaleIndex();
+  auto result = baselines.find(key);
+  if (result == baselines.end()) {
+    baselines[key] = {median, drawCount};
+    tgfx::PrintLog("Soak phase %zu: %s at %.0f%%, p50 %.2fms, p99 %.2fms, count %zu", phaseIndex,
+                   name.c_str(), scale * 100.f, ToMilliseconds(median), ToMilliseconds(p99),
+                   drawCount);
+    return;
+  }
+  auto& baseline = result->second;
+  tgfx::PrintLog("Soak phase %zu: %s at %.0f%%, p50 %.2fms, p99 %.2fms, count %zu, "
+                 "baseline p50 %.2fms, baseline count %zu",
+                 phaseIndex, name.c_str(), scale * 100.f, ToMilliseconds(median),
+                 ToMilliseconds(p99), drawCount, ToMilliseconds(baseline.medianTime),
+                 baseline.drawCount);
+  if (median - baseline.medianTime > SOAK_DRIFT_MIN_TIME &&
+      static_cast<float>(median) >
+          static_cast<float>(baseline.medianTime) * (1.f + SOAK_DRIFT_RATIO)) {
+    warn("%s at %.0f%% drifted from a p50 of %.2fms to %.2fms", name.c_str(), scale * 100.f,
+         ToMilliseconds(baseline.medianTime), ToMilliseconds(median));
+  }
+  if (baseline.drawCount > 0 &&
+      static_cast<float>(drawCount) <
+          static_cast<float>(baseline.drawCount) * (1.f - SOAK_DRIFT_RATIO)) {
+    warn("%s at %.0f%% drifted from a count of %zu to %zu", name.c_str(), scale * 100.f,
+         baseline.drawCount, drawCount);
+  }
+}
+
+void SoakRunner::finishInterval(int64_t currentTime) {
+  MemorySample sample = {};
+  size_t peakResidentBytes = 0;
+  MemoryTracker::ReadResidentSize(&sample.residentBytes, &peakResidentBytes);
+  sample.gpuBytes = intervalPeakGPUBytes;
+  sample.heapBytes = MemoryTracker::LiveBytes();
+  samples.push_back(sample);
+  auto frameCount = intervalFrameTimes.size();
+  auto median = Percentile(&intervalFrameTimes, 0.5f);
+  auto p90 = Percentile(&intervalFrameTimes, 0.9f);
+  auto p99 = Percentile(&intervalFrameTimes, 0.99f);
+  auto elapsed = (currentTime - startTime) / 1000000;
+  tgfx::PrintLog("Soak %lld:%02lld:%02lld, %zu frames, p50 %.2fms, p90 %.2fms, p99 %.2fms, "
+                 "RSS %.1fMB (peak %.1fMB), GPU %.1fMB, heap %.1fMB",
+                 static_cast<long long>(elapsed / 3600), static_cast<long long>(elapsed / 60 % 60),
+                 static_cast<long long>(elapsed % 60), frameCount, ToMilliseconds(median),
+                 ToMilliseconds(p90), ToMilliseconds(p99), ToMB(sample.residentBytes),
+                 ToMB(peakResidentBytes), ToMB(sample.gpuBytes), ToMB(sample.heapBytes));
+  checkGrowth("RSS", &MemorySample::residentBytes);
+  checkGrowth("GPU memory", &MemorySample::gpuBytes);
+  checkGrowth("Heap", &MemorySample::heapBytes);
+  intervalFrameTimes.clear();
+  intervalPeakGPUBytes = 0;
+  intervalStartTime = currentTime;
+}
+
+void SoakRunner::checkGrowth(const char* name, size_t MemorySample::*field) {
+  if (samples.size() <= SOAK_GROWTH_INTERVALS) {
+    return;
+  }
+  auto first = samples.size() - SOAK_GROWTH_INTERVALS - 1;
+  for (auto i = first + 1; i < samples.size(); i++) {
+    if (samples[i].*field < samples[i - 1].*field) {
+      return;
+    }
+  }
+  auto startBytes = samples[first].*field;
+  auto endBytes = samples.back().*field;
+  if (endBytes - startBytes > SOAK_GROWTH_MIN_BYTES) {
+    warn("%s grew from %.1fMB to %.1fMB over the last %zu intervals", name, ToMB(startBytes),
+         ToMB(endBytes), SOAK_GROWTH_INTERVALS);
+  }
+}
+
+void SoakRunner::warn(const char* format, ...) {
+  char message[512] = {};
+  va_list args;
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+  tgfx::PrintError("Soak warning: %s!", message);
+  warningCount++;
+}
+
+void SoakRunner::finish(int64_t currentTime) {
+  tgfx::PrintLog("Soak finished after %lld minutes and %zu phases with %d warnings.",
+                 static_cast<long long>((currentTime - startTime) / 60000000), phaseIndex,
+                 warningCount);
+#ifndef __EMSCRIPTEN__
+  std::exit(warningCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+#endif
+}
+}  // namespace benchmark
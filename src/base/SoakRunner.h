@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "base/AppHost.h"
+
+namespace benchmark {
+
+/**
+ * SoakRunner drives long unattended runs that look for leaks, fragmentation and slowdowns that only
+ * show up after hours. It cycles through all benches, holding each one for a fixed number of frames
+ * per phase, resets the frames halfway through each phase and scales the window between phases, so
+ * the setup and teardown paths of the benches run thousands of times. At the end of each phase it
+ * compares the median frame time of the bench, and the particle count its ramp reached, against its
+ * first phase at the same window scale. The ramp trades frame time for particles, so a slowdown
+ * mostly shows up as a lower count. At every interval it logs the resident, GPU and heap memory
+ * and checks whether they have grown over several intervals in a row. Findings are logged as
+ * warnings, and the process exits with a failure code at the end of the run if there were any.
+ */
+class SoakRunner {
+ public:
+  /**
+   * Enables the soak mode for the given number of minutes. A duration of 0 runs until the window
+   * is closed.
+   */
+  static void Enable(int64_t durationMinutes);
+
+  /**
+   * Returns true if the soak mode is enabled.
+   */
+  static bool IsEnabled();
+
+  /**
+   * Sets the interval between memory samples in seconds. The default value is 60.
+   */
+  static void SetInterval(int64_t seconds);
+
+  /**
+   * Returns the index of the bench drawn in the current phase.
+   */
+  int benchIndex() const;
+
+  /**
+   * Returns the window size of the current phase relative to the size the run started with.
+   */
+  float windowScale() const;
+
+  /**
+   * Records a frame drawn by the render loop with the given draw time in microseconds. Returns
+   * true if a new phase has started, in which case the render loop switches to benchIndex() and
+   * scales its window by windowScale(). The frames of the host are reset here.
+   */
+  bool recordFrame(AppHost* host, int64_t drawTime);
+
+ private:
+  struct PhaseBaseline {
+    int64_t medianTime = 0;
+    size_t drawCount = 0;
+  };
+
+  struct MemorySample {
+    size_t residentBytes = 0;
+    size_t gpuBytes = 0;
+    size_t heapBytes = 0;
+  };
+
+  size_t scaleIndex() const;
+
+  bool isWarmUpFrame() const;
+
+  void finishPhase(size_t drawCount);
+
+  void finishInterval(int64_t currentTime);
+
+  void checkGrowth(const char* name, size_t MemorySample::*field);
+
+  void finish(int64_t currentTime);
+
+  void warn(const char* format, ...);
+
+  int64_t startTime = -1;
+  int64_t intervalStartTime = 0;
+  size_t phaseIndex = 0;
+  int64_t phaseFrames = 0;
+  std::vector<int64_t> phaseFrameTimes = {};
+  std::vector<int64_t> intervalFrameTimes = {};
+  size_t intervalPeakGPUBytes = 0;
+  // The first phase of each bench and window scale.
+  std::unordered_map<size_t, PhaseBaseline> baselines = {};
+  std::vector<MemorySample> samples = {};
+  int warningCount = 0;
+};
+
+}  // namespace benchmark
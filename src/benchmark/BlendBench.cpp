@@ -0,0 +1,109 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BlendBench.h"
+#include <iomanip>
+#include <sstream>
+
+namespace benchmark {
+static constexpr size_t MAX_LAYER_COUNT = 2000;
+static constexpr size_t MAX_LAYER_STEP = 10;
+static constexpr float LAYER_INSET = 0.05f;
+
+static float LayerAlpha = 0.1f;
+
+static std::string ToString(tgfx::BlendMode mode) {
+  switch (mode) {
+    case tgfx::BlendMode::SrcOver:
+      return "SrcOver";
+    case tgfx::BlendMode::Multiply:
+      return "Multiply";
+    case tgfx::BlendMode::Screen:
+      return "Screen";
+    case tgfx::BlendMode::Overlay:
+      return "Overlay";
+    case tgfx::BlendMode::Difference:
+      return "Difference";
+    default:
+      return "Unknown";
+  }
+}
+
+BlendBench::BlendBench(tgfx::BlendMode mode)
+    : ParticleBench("BlendBench-" + ToString(mode), GraphicType::Rect), blendMode(mode) {
+}
+
+void BlendBench::SetLayerAlpha(float alpha) {
+  LayerAlpha = std::max(0.f, std::min(alpha, 1.f));
+}
+
+void BlendBench::onInit(const AppHost*) {
+  for (size_t i = 0; i < 3; i++) {
+    layerPaints[i] = paints[i];
+    layerPaints[i].setStyle(tgfx::PaintStyle::Fill);
+    layerPaints[i].setAlpha(LayerAlpha);
+    layerPaints[i].setBlendMode(blendMode);
+  }
+  // Every layer covers most of the screen, with a small per-layer offset so that consecutive
+  // layers never have identical bounds.
+  auto layerRect = tgfx::Rect::MakeWH(width, height);
+  layerRect.inset(width * LAYER_INSET, height * LAYER_INSET);
+  auto maxOffset = std::min(width, height) * LAYER_INSET;
+  auto maxCount = maxDrawCount();
+  for (size_t i = 0; i < maxCount; i++) {
+    auto& rect = graphics[i].rect;
+    rect = layerRect;
+    rect.offset(graphics[i].speedX / 5.f * maxOffset, graphics[i].speedY / 5.f * maxOffset);
+  }
+}
+
+void BlendBench::onAnimate(const AppHost*) {
+  // The layers stay still so that the blended area is the same in every frame.
+}
+
+void BlendBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  for (size_t i = 0; i < drawCount; i++) {
+    canvas->drawRect(graphics[i].rect, layerPaints[i % 3]);
+  }
+}
+
+void BlendBench::onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) {
+  auto drawTime = host->averageDrawTime();
+  if (drawTime <= 0) {
+    return;
+  }
+  auto layerArea = static_cast<double>(graphics[0].rect.width() * graphics[0].rect.height());
+  // Layer area per millisecond of CPU frame time, in megapixels. The GPU runs asynchronously and
+  // the frame is often bound by vsync, so this is not the fill rate of the GPU.
+  auto areaRate = layerArea * static_cast<double>(drawCount) / static_cast<double>(drawTime);
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(2) << areaRate;
+  lines->push_back("Area/CPU: " + oss.str() + "Mpx/ms");
+  oss.str("");
+  oss << std::fixed << std::setprecision(2) << LayerAlpha;
+  lines->push_back("Alpha: " + oss.str());
+}
+
+size_t BlendBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), MAX_LAYER_COUNT);
+}
+
+size_t BlendBench::increaseStep() const {
+  return std::min(ParticleBench::increaseStep(), MAX_LAYER_STEP);
+}
+}  // namespace benchmark
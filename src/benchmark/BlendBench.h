@@ -0,0 +1,58 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+/**
+ * BlendBench stacks translucent layers that cover most of the screen to measure fill rate and
+ * blending cost. Each particle is one layer, so the draw count is the overdraw depth. The status
+ * bar reports the blended layer area per millisecond of CPU frame time, which only approaches the
+ * fill rate once the frames are bound by the GPU.
+ */
+class BlendBench : public ParticleBench {
+ public:
+  explicit BlendBench(tgfx::BlendMode mode);
+
+  /**
+   * Sets the alpha of every layer, in the range [0, 1]. The default value is 0.1.
+   */
+  static void SetLayerAlpha(float alpha);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+  size_t increaseStep() const override;
+
+ private:
+  tgfx::BlendMode blendMode = tgfx::BlendMode::SrcOver;
+  tgfx::Paint layerPaints[3];
+};
+
+}  // namespace benchmark
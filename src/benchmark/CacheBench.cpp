@@ -0,0 +1,338 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CacheBench.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include "tgfx/core/Surface.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+static constexpr size_t CACHE_DRAW_COUNT = 300;
+static constexpr size_t PATH_COUNT = 1500;
+static constexpr float PATH_SIZE = 48.f;
+static constexpr size_t IMAGE_COUNT = 600;
+static constexpr int IMAGE_SIZE = 96;
+static constexpr char FIRST_GLYPH = 33;
+static constexpr size_t GLYPH_COUNT = 94;
+static constexpr size_t FONT_SIZE_COUNT = 24;
+static constexpr float MIN_FONT_SIZE = 12.f;
+static constexpr float FONT_SIZE_STEP = 2.f;
+// Higher values make the popular resources more popular. Picking the rank as N * u^3 for a uniform
+// u means the top 10% of the resources receive about 46% of the draws.
+static constexpr float POPULARITY_SKEW = 3.f;
+static constexpr float CACHE_LIMIT_FRACTIONS[] = {2.f, 1.f, 0.75f, 0.5f, 0.25f, 0.125f};
+static constexpr size_t CACHE_STEP_COUNT =
+    sizeof(CACHE_LIMIT_FRACTIONS) / sizeof(CACHE_LIMIT_FRACTIONS[0]);
+// The frames to fill the cache after changing the limit, and the frames measured after them.
+static constexpr int64_t CACHE_WARM_UP_FRAMES = 30;
+static constexpr int64_t CACHE_MEASURE_FRAMES = 180;
+static constexpr float BYTES_PER_MB = 1024.f * 1024.f;
+
+static std::string ToString(CacheWorkload workload) {
+  switch (workload) {
+    case CacheWorkload::Path:
+      return "Path";
+    case CacheWorkload::Image:
+      return "Image";
+    case CacheWorkload::Glyph:
+      return "Glyph";
+    default:
+      return "Unknown";
+  }
+}
+
+CacheBench::CacheBench(CacheWorkload workload)
+    : ParticleBench("CacheBench-" + ToString(workload), GraphicType::Rect), workload(workload) {
+}
+
+size_t CacheBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), CACHE_DRAW_COUNT);
+}
+
+void CacheBench::createResources(const AppHost* host) {
+  auto density = host->density();
+  if (resourceDensity == density && !resourceBytes.empty()) {
+    return;
+  }
+  resourceDensity = density;
+  paths.clear();
+  images.clear();
+  fonts.clear();
+  glyphTexts.clear();
+  resourceBytes.clear();
+  std::mt19937 shapeRng(49);
+  std::uniform_real_distribution<float> distribution(0, 1);
+  if (workload == CacheWorkload::Path) {
+    // Random polygons with curved edges, each one rasterized into its own mask.
+    auto size = PATH_SIZE * density;
+    for (size_t i = 0; i < PATH_COUNT; i++) {
+      auto points = 5 + static_cast<int>(distribution(shapeRng) * 8.f);
+      tgfx::Path path;
+      for (int j = 0; j < points; j++) {
+        auto angle = 2.f * static_cast<float>(M_PI) * static_cast<float>(j) /
+                     static_cast<float>(points);
+        auto radius = size * (0.25f + distribution(shapeRng) * 0.25f);
+        auto x = size * 0.5f + radius * std::cos(angle);
+        auto y = size * 0.5f + radius * std::sin(angle);
+        if (j == 0) {
+          path.moveTo(x, y);
+        } else {
+          path.quadTo(size * distribution(shapeRng), size * distribution(shapeRng), x, y);
+        }
+      }
+      path.close();
+      auto bounds = path.getBounds();
+      resourceBytes.push_back(static_cast<size_t>(std::ceil(bounds.width())) *
+                              static_cast<size_t>(std::ceil(bounds.height())));
+      paths.push_back(path);
+    }
+  } else if (workload == CacheWorkload::Image) {
+    auto info = tgfx::ImageInfo::Make(IMAGE_SIZE, IMAGE_SIZE, tgfx::ColorType::RGBA_8888);
+    std::vector<uint8_t> pixels(info.byteSize());
+    for (size_t i = 0; i < IMAGE_COUNT; i++) {
+      // A distinct gradient per image, so no two images share their content.
+      auto red = static_cast<int>(distribution(shapeRng) * 255.f);
+      auto green = static_cast<int>(distribution(shapeRng) * 255.f);
+      for (int y = 0; y < IMAGE_SIZE; y++) {
+        for (int x = 0; x < IMAGE_SIZE; x++) {
+          auto pixel = pixels.data() + (static_cast<size_t>(y * IMAGE_SIZE + x) * 4);
+          pixel[0] = static_cast<uint8_t>((red + x) & 0xFF);
+          pixel[1] = static_cast<uint8_t>((green + y) & 0xFF);
+          pixel[2] = static_cast<uint8_t>(i & 0xFF);
+          pixel[3] = 255;
+        }
+      }
+      images.push_back(tgfx::Image::MakeFrom(info, tgfx::Data::MakeWithCopy(pixels.data(),
+                                                                            pixels.size())));
+      resourceBytes.push_back(info.byteSize());
+    }
+  } else {
+    for (size_t i = 0; i < GLYPH_COUNT; i++) {
+      glyphTexts.emplace_back(1, static_cast<char>(FIRST_GLYPH + static_cast<int>(i)));
+    }
+    for (size_t i = 0; i < FONT_SIZE_COUNT; i++) {
+      auto fontSize = (MIN_FONT_SIZE + FONT_SIZE_STEP * static_cast<float>(i)) * density;
+      fonts.emplace_back(host->getTypeface("default"), fontSize);
+      // A glyph covers roughly 0.6 by 0.8 em of its alpha mask.
+      auto glyphBytes = std::ceil(fontSize * 0.6f) * std::ceil(fontSize * 0.8f);
+      resourceBytes.insert(resourceBytes.end(), GLYPH_COUNT, static_cast<size_t>(glyphBytes));
+    }
+  }
+  workingSetBytes = 0;
+  for (auto bytes : resourceBytes) {
+    workingSetBytes += bytes;
+  }
+  resourceOrder.resize(resourceBytes.size());
+  for (size_t i = 0; i < resourceOrder.size(); i++) {
+    resourceOrder[i] = i;
+  }
+  std::shuffle(resourceOrder.begin(), resourceOrder.end(), shapeRng);
+}
+
+void CacheBench::resetCacheModel() {
+  auto count = resourceBytes.size();
+  cachedList.clear();
+  uncachedList.clear();
+  listPositions.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    listPositions[i] = uncachedList.insert(uncachedList.end(), i);
+  }
+  cachedFlags.assign(count, 0);
+  lastUsedFrames.assign(count, -1);
+  cachedBytes = 0;
+}
+
+void CacheBench::onInit(const AppHost* host) {
+  createResources(host);
+  resetCacheModel();
+  frameResources.resize(maxDrawCount());
+  rng.seed(49);
+  stepIndex = 0;
+  frameIndex = 0;
+  stepFrames = 0;
+  stepDraws = 0;
+  stepHits = 0;
+  stepEvictedBytes = 0;
+  stepDrawTime = 0;
+  stepPeakGPUMemory = 0;
+  drawCount = maxDrawCount();
+}
+
+size_t CacheBench::stepCacheLimit() const {
+  return static_cast<size_t>(static_cast<float>(workingSetBytes) *
+                             CACHE_LIMIT_FRACTIONS[stepIndex]);
+}
+
+bool CacheBench::isMeasuring() const {
+  return stepFrames > CACHE_WARM_UP_FRAMES;
+}
+
+void CacheBench::onAnimate(const AppHost* host) {
+  if (isMeasuring()) {
+    // The host reports the time of the previous frame, which belongs to this step as well.
+    stepDrawTime += host->lastDrawTime();
+    stepPeakGPUMemory = std::max(stepPeakGPUMemory, host->gpuMemoryUsage());
+  }
+  if (stepFrames >= CACHE_WARM_UP_FRAMES + CACHE_MEASURE_FRAMES) {
+    finishStep();
+  }
+  frameIndex++;
+  stepFrames++;
+  std::uniform_real_distribution<float> distribution(0, 1);
+  auto count = static_cast<float>(resourceOrder.size());
+  for (auto& resource : frameResources) {
+    auto rank = static_cast<size_t>(count * std::pow(distribution(rng), POPULARITY_SKEW));
+    resource = resourceOrder[std::min(rank, resourceOrder.size() - 1)];
+  }
+}
+
+void CacheBench::finishStep() {
+  auto frames = static_cast<float>(CACHE_MEASURE_FRAMES);
+  auto hitRate = stepDraws > 0 ? static_cast<float>(stepHits) / static_cast<float>(stepDraws) : 0;
+  tgfx::PrintLog("%s: limit %.1fMB (%.0f%% of %.1fMB), model hit rate %.1f%%, "
+                 "model evicted %.2fMB/frame, time %.2fms, GPU peak %.1fMB",
+                 name().c_str(), static_cast<float>(stepCacheLimit()) / BYTES_PER_MB,
+                 CACHE_LIMIT_FRACTIONS[stepIndex] * 100.f,
+                 static_cast<float>(workingSetBytes) / BYTES_PER_MB, hitRate * 100.f,
+                 static_cast<float>(stepEvictedBytes) / BYTES_PER_MB / frames,
+                 static_cast<float>(stepDrawTime) / 1000.f / frames,
+                 static_cast<float>(stepPeakGPUMemory) / BYTES_PER_MB);
+  stepIndex = (stepIndex + 1) % CACHE_STEP_COUNT;
+  stepFrames = 0;
+  stepDraws = 0;
+  stepHits = 0;
+  stepEvictedBytes = 0;
+  stepDrawTime = 0;
+  stepPeakGPUMemory = 0;
+}
+
+void CacheBench::touchResource(size_t resource) {
+  auto measuring = isMeasuring();
+  if (measuring) {
+    stepDraws++;
+  }
+  if (cachedFlags[resource]) {
+    if (measuring) {
+      stepHits++;
+    }
+    cachedList.splice(cachedList.begin(), cachedList, listPositions[resource]);
+  } else {
+    cachedList.splice(cachedList.begin(), uncachedList, listPositions[resource]);
+    cachedFlags[resource] = 1;
+    cachedBytes += resourceBytes[resource];
+  }
+  lastUsedFrames[resource] = frameIndex;
+}
+
+void CacheBench::evictResources() {
+  auto limit = stepCacheLimit();
+  while (cachedBytes > limit && !cachedList.empty()) {
+    auto resource = cachedList.back();
+    // Resources used by the current frame cannot be purged, and they are all in front of this one.
+    if (lastUsedFrames[resource] == frameIndex) {
+      break;
+    }
+    uncachedList.splice(uncachedList.begin(), cachedList, listPositions[resource]);
+    cachedFlags[resource] = 0;
+    cachedBytes -= resourceBytes[resource];
+    if (isMeasuring()) {
+      stepEvictedBytes += resourceBytes[resource];
+    }
+  }
+}
+
+void CacheBench::drawResource(tgfx::Canvas* canvas, size_t resource,
+                              const tgfx::Rect& cell) const {
+  auto& paint = paints[resource % 3];
+  switch (workload) {
+    case CacheWorkload::Path:
+      // Integer offsets keep the rasterized masks reusable between frames.
+      canvas->setMatrix(tgfx::Matrix::MakeTrans(std::round(cell.left), std::round(cell.top)));
+      canvas->drawPath(paths[resource], paint);
+      break;
+    case CacheWorkload::Image:
+      canvas->drawImageRect(images[resource], cell,
+                            tgfx::SamplingOptions(tgfx::FilterMode::Linear));
+      break;
+    case CacheWorkload::Glyph: {
+      auto& font = fonts[resource / GLYPH_COUNT];
+      canvas->drawSimpleText(glyphTexts[resource % GLYPH_COUNT], cell.left,
+                             cell.top + font.getSize(), font, paint);
+      break;
+    }
+  }
+}
+
+void CacheBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  auto surface = canvas->getSurface();
+  if (surface == nullptr || surface->getContext() == nullptr) {
+    return;
+  }
+  auto context = surface->getContext();
+  if (!hasDefaultCacheLimit) {
+    defaultCacheLimit = context->cacheLimit();
+    hasDefaultCacheLimit = true;
+  }
+  context->setCacheLimit(stepCacheLimit());
+  // Lays the resources out in a grid of roughly square cells covering the screen.
+  auto aspect = width / height;
+  auto columns = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(drawCount) * aspect)));
+  columns = std::max(columns, static_cast<size_t>(1));
+  auto rows = std::max((drawCount + columns - 1) / columns, static_cast<size_t>(1));
+  auto cellWidth = width / static_cast<float>(columns);
+  auto cellHeight = height / static_cast<float>(rows);
+  for (size_t i = 0; i < drawCount; i++) {
+    auto resource = frameResources[i];
+    auto cell = tgfx::Rect::MakeXYWH(cellWidth * static_cast<float>(i % columns),
+                                     cellHeight * static_cast<float>(i / columns), cellWidth,
+                                     cellHeight);
+    drawResource(canvas, resource, cell);
+    touchResource(resource);
+  }
+  canvas->resetMatrix();
+  evictResources();
+}
+
+void CacheBench::onExit(tgfx::Canvas* canvas) {
+  auto surface = canvas->getSurface();
+  if (!hasDefaultCacheLimit || surface == nullptr || surface->getContext() == nullptr) {
+    return;
+  }
+  surface->getContext()->setCacheLimit(defaultCacheLimit);
+}
+
+void CacheBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1)
+      << static_cast<float>(stepCacheLimit()) / BYTES_PER_MB;
+  lines->push_back("Limit: " + oss.str() + "MB");
+  if (stepDraws == 0) {
+    return;
+  }
+  oss.str("");
+  oss << static_cast<float>(stepHits) * 100.f / static_cast<float>(stepDraws);
+  lines->push_back("Model hit: " + oss.str() + "%");
+  oss.str("");
+  auto frames = static_cast<float>(stepFrames - CACHE_WARM_UP_FRAMES);
+  oss << std::setprecision(2) << static_cast<float>(stepEvictedBytes) / BYTES_PER_MB / frames;
+  lines->push_back("Model evict: " + oss.str() + "MB");
+}
+}  // namespace benchmark
@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <list>
+#include <random>
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+enum class CacheWorkload { Path, Image, Glyph };
+
+/**
+ * CacheBench measures how the frame time degrades once the working set of a scene outgrows the GPU
+ * resource cache. Each frame draws a fixed number of resources picked from a larger set of distinct
+ * paths, images or glyphs, with a skewed distribution so that a few resources are drawn far more
+ * often than the rest, as in real content. The bench sweeps the cache limit of the context through
+ * fractions of the working set size, holding each limit for a fixed number of frames, and logs the
+ * average frame time of each step. tgfx does not expose cache hit counters, so the hit rate and
+ * eviction rate come from an LRU model of the cache fed with the estimated GPU size of each
+ * resource, logged next to the GPU memory reported by the context to keep the model honest.
+ */
+class CacheBench : public ParticleBench {
+ public:
+  explicit CacheBench(CacheWorkload workload);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  void onExit(tgfx::Canvas* canvas) override;
+
+  size_t maxDrawCount() const override;
+
+ private:
+  void createResources(const AppHost* host);
+
+  void resetCacheModel();
+
+  void drawResource(tgfx::Canvas* canvas, size_t resource, const tgfx::Rect& cell) const;
+
+  void touchResource(size_t resource);
+
+  void evictResources();
+
+  void finishStep();
+
+  size_t stepCacheLimit() const;
+
+  bool isMeasuring() const;
+
+  CacheWorkload workload = CacheWorkload::Path;
+  float resourceDensity = 0;
+  std::vector<tgfx::Path> paths = {};
+  std::vector<std::shared_ptr<tgfx::Image>> images = {};
+  std::vector<tgfx::Font> fonts = {};
+  std::vector<std::string> glyphTexts = {};
+  // The estimated GPU size of each resource in bytes.
+  std::vector<size_t> resourceBytes = {};
+  // Maps the popularity rank to a resource, so the popular resources are spread over all sizes.
+  std::vector<size_t> resourceOrder = {};
+  size_t workingSetBytes = 0;
+  std::vector<size_t> frameResources = {};
+  std::mt19937 rng = {};
+  // The LRU model, with the most recently used resources at the front of cachedList.
+  std::list<size_t> cachedList = {};
+  std::list<size_t> uncachedList = {};
+  std::vector<std::list<size_t>::iterator> listPositions = {};
+  std::vector<uint8_t> cachedFlags = {};
+  std::vector<int64_t> lastUsedFrames = {};
+  size_t cachedBytes = 0;
+  size_t defaultCacheLimit = 0;
+  bool hasDefaultCacheLimit = false;
+  size_t stepIndex = 0;
+  int64_t frameIndex = 0;
+  int64_t stepFrames = 0;
+  size_t stepDraws = 0;
+  size_t stepHits = 0;
+  size_t stepEvictedBytes = 0;
+  int64_t stepDrawTime = 0;
+  size_t stepPeakGPUMemory = 0;
+};
+
+}  // namespace benchmark
@@ -0,0 +1,150 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ClipBench.h"
+#include <cmath>
+
+namespace benchmark {
+static constexpr int MAX_CLIP_DEPTH = 32;
+// Each level keeps this fraction of the size of the previous one.
+static constexpr float LEVEL_SCALE = 0.9f;
+// The smallest clip of a level in pixels, so that deep stacks on small particles still draw.
+static constexpr float MIN_LEVEL_SIZE = 1.f;
+
+static int ClipDepth = 3;
+
+static std::string ToString(ClipShape shape) {
+  switch (shape) {
+    case ClipShape::Rect:
+      return "Rect";
+    case ClipShape::RRect:
+      return "RRect";
+    case ClipShape::Path:
+      return "Path";
+    default:
+      return "Unknown";
+  }
+}
+
+// Returns the clip of the given nesting level, shrinking and shifting a little at each level so
+// that every clip in the stack really cuts the previous ones. The size shrinks geometrically.
+static tgfx::Rect GetLevelRect(const tgfx::Rect& rect, int level) {
+  auto result = rect;
+  auto scale = std::pow(LEVEL_SCALE, static_cast<float>(level));
+  auto inset = rect.width() * (1.f - scale) * 0.5f;
+  result.inset(inset, inset);
+  auto shift = (level % 2 == 0 ? 1.f : -1.f) * rect.width() * 0.03f * scale;
+  result.offset(shift, -shift);
+  return result;
+}
+
+static tgfx::Path CreateBlob(const tgfx::Rect& rect, int level) {
+  tgfx::Path path;
+  auto centerX = rect.centerX();
+  auto centerY = rect.centerY();
+  auto radius = rect.width() * 0.5f;
+  constexpr int lobes = 6;
+  auto angleStep = static_cast<float>(M_PI) * 2.f / lobes;
+  auto phase = angleStep * 0.25f * static_cast<float>(level);
+  path.moveTo(centerX + radius * std::cos(phase), centerY + radius * std::sin(phase));
+  for (int i = 1; i <= lobes; i++) {
+    auto angle = phase + angleStep * static_cast<float>(i);
+    auto controlAngle = angle - angleStep * 0.5f;
+    auto controlRadius = radius * 0.55f;
+    auto controlX = centerX + controlRadius * std::cos(controlAngle);
+    auto controlY = centerY + controlRadius * std::sin(controlAngle);
+    path.quadTo(controlX, controlY, centerX + radius * std::cos(angle),
+                centerY + radius * std::sin(angle));
+  }
+  path.close();
+  return path;
+}
+
+ClipBench::ClipBench(ClipShape shape)
+    : ParticleBench("ClipBench-" + ToString(shape), GraphicType::Rect), clipShape(shape) {
+}
+
+void ClipBench::SetClipDepth(int depth) {
+  ClipDepth = std::max(1, std::min(depth, MAX_CLIP_DEPTH));
+}
+
+void ClipBench::onInit(const AppHost*) {
+  unitClips.clear();
+  if (clipShape == ClipShape::Rect) {
+    return;
+  }
+  auto unitRect = tgfx::Rect::MakeXYWH(-0.5f, -0.5f, 1.f, 1.f);
+  for (int level = 0; level < ClipDepth; level++) {
+    auto levelRect = GetLevelRect(unitRect, level);
+    tgfx::Path path;
+    if (clipShape == ClipShape::RRect) {
+      auto radius = levelRect.width() * 0.25f;
+      path.addRoundRect(levelRect, radius, radius);
+    } else {
+      path = CreateBlob(levelRect, level);
+    }
+    unitClips.push_back(path);
+  }
+}
+
+void ClipBench::clipRects(tgfx::Canvas* canvas, const tgfx::Rect& rect, bool pixelAligned) const {
+  // Every level keeps the pixel under the center of the particle once snapped, so rounding can
+  // neither empty a level nor make two levels miss each other.
+  auto centerPixel = tgfx::Rect::MakeXYWH(std::floor(rect.centerX()), std::floor(rect.centerY()),
+                                          MIN_LEVEL_SIZE, MIN_LEVEL_SIZE);
+  for (int level = 0; level < ClipDepth; level++) {
+    auto levelRect = GetLevelRect(rect, level);
+    auto growX = std::max(MIN_LEVEL_SIZE - levelRect.width(), 0.f) * 0.5f;
+    auto growY = std::max(MIN_LEVEL_SIZE - levelRect.height(), 0.f) * 0.5f;
+    levelRect.outset(growX, growY);
+    if (pixelAligned) {
+      levelRect.round();
+      levelRect.join(centerPixel);
+    }
+    canvas->clipRect(levelRect);
+  }
+}
+
+void ClipBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  // Clips are always anti-aliased in tgfx. With anti-aliasing turned off, rect clips are snapped to
+  // whole pixels instead, which lets the renderer skip coverage masks for them.
+  auto pixelAligned = !paints[0].isAntiAlias();
+  for (size_t i = 0; i < drawCount; i++) {
+    auto& rect = graphics[i].rect;
+    auto& paint = paints[i % 3];
+    canvas->save();
+    if (clipShape == ClipShape::Rect) {
+      clipRects(canvas, rect, pixelAligned);
+      canvas->drawRect(rect, paint);
+    } else {
+      canvas->translate(rect.centerX(), rect.centerY());
+      canvas->scale(rect.width(), rect.height());
+      for (auto& clip : unitClips) {
+        canvas->clipPath(clip);
+      }
+      canvas->drawRect(tgfx::Rect::MakeXYWH(-0.5f, -0.5f, 1.f, 1.f), paint);
+    }
+    canvas->restore();
+  }
+  canvas->drawRect(startRect, {});
+}
+
+void ClipBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  lines->push_back("Depth: " + std::to_string(ClipDepth));
+}
+}  // namespace benchmark
@@ -0,0 +1,56 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+enum class ClipShape { Rect, RRect, Path };
+
+/**
+ * ClipBench draws every particle inside its own save/clip/restore block with a stack of nested
+ * clips, to measure the cost of clip mask generation and caching.
+ */
+class ClipBench : public ParticleBench {
+ public:
+  explicit ClipBench(ClipShape shape);
+
+  /**
+   * Sets the number of nested clips applied to each particle, clamped to [1, 32]. The default value
+   * is 3.
+   */
+  static void SetClipDepth(int depth);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+ private:
+  void clipRects(tgfx::Canvas* canvas, const tgfx::Rect& rect, bool pixelAligned) const;
+
+  ClipShape clipShape = ClipShape::Rect;
+  // Clip paths of each nesting level, in a unit square centered at the origin.
+  std::vector<tgfx::Path> unitClips = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,129 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CullingBench.h"
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+
+namespace benchmark {
+static constexpr float WORLD_SCALE = 8.f;
+static constexpr float CELL_SIZE = 64.f;
+static constexpr float CAMERA_SPEED = 0.002f;
+
+static std::string ToString(CullingMode mode) {
+  switch (mode) {
+    case CullingMode::Unculled:
+      return "Unculled";
+    case CullingMode::Culled:
+      return "Culled";
+    default:
+      return "Unknown";
+  }
+}
+
+CullingBench::CullingBench(CullingMode mode)
+    : ParticleBench("CullingBench-" + ToString(mode), GraphicType::Rect), cullingMode(mode) {
+}
+
+void CullingBench::onInit(const AppHost* host) {
+  worldRect = tgfx::Rect::MakeWH(width * WORLD_SCALE, height * WORLD_SCALE);
+  std::mt19937 positionRng(72);
+  std::uniform_real_distribution<float> xDistribution(0, worldRect.width());
+  std::uniform_real_distribution<float> yDistribution(0, worldRect.height());
+  maxHalfSize = 0;
+  auto maxCount = maxDrawCount();
+  for (size_t i = 0; i < maxCount; i++) {
+    auto& rect = graphics[i].rect;
+    rect.offsetTo(xDistribution(positionRng), yDistribution(positionRng));
+    maxHalfSize = std::max(maxHalfSize, std::max(rect.width(), rect.height()) * 0.5f);
+  }
+  grid.reset(worldRect, CELL_SIZE * host->density());
+  visibleIDs.clear();
+  visibleCount = 0;
+  frameIndex = 0;
+  indexTime = 0;
+}
+
+void CullingBench::onAnimate(const AppHost*) {
+  // The camera circles around the world, crossing regions it has not visited for a while.
+  auto angle = static_cast<float>(frameIndex++) * CAMERA_SPEED;
+  auto centerX = worldRect.centerX() + std::cos(angle) * (worldRect.width() - width) * 0.5f;
+  auto centerY = worldRect.centerY() + std::sin(angle * 2.f) * (worldRect.height() - height) * 0.5f;
+  viewRect = tgfx::Rect::MakeXYWH(centerX - width * 0.5f, centerY - height * 0.5f, width, height);
+  for (size_t i = 0; i < drawCount; i++) {
+    auto& graphic = graphics[i];
+    auto& rect = graphic.rect;
+    rect.offset(graphic.speedX, graphic.speedY);
+    if ((rect.left < worldRect.left && graphic.speedX < 0) ||
+        (rect.right > worldRect.right && graphic.speedX > 0)) {
+      graphic.speedX = -graphic.speedX;
+    }
+    if ((rect.top < worldRect.top && graphic.speedY < 0) ||
+        (rect.bottom > worldRect.bottom && graphic.speedY > 0)) {
+      graphic.speedY = -graphic.speedY;
+    }
+  }
+  if (cullingMode == CullingMode::Unculled) {
+    return;
+  }
+  auto startTime = tgfx::Clock::Now();
+  auto indexedCount = grid.count();
+  for (size_t i = 0; i < indexedCount; i++) {
+    grid.move(static_cast<uint32_t>(i), graphics[i].rect);
+  }
+  for (auto i = indexedCount; i < drawCount; i++) {
+    grid.insert(static_cast<uint32_t>(i), graphics[i].rect);
+  }
+  indexTime = tgfx::Clock::Now() - startTime;
+}
+
+void CullingBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  canvas->save();
+  canvas->translate(-viewRect.left, -viewRect.top);
+  if (cullingMode == CullingMode::Unculled) {
+    for (size_t i = 0; i < drawCount; i++) {
+      canvas->drawRect(graphics[i].rect, paints[i % 3]);
+    }
+    visibleCount = drawCount;
+  } else {
+    visibleIDs.clear();
+    grid.query(viewRect, maxHalfSize, &visibleIDs);
+    visibleCount = 0;
+    for (auto id : visibleIDs) {
+      auto& rect = graphics[id].rect;
+      if (rect.intersects(viewRect)) {
+        canvas->drawRect(rect, paints[id % 3]);
+        visibleCount++;
+      }
+    }
+  }
+  canvas->restore();
+}
+
+void CullingBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  lines->push_back("Drawn: " + std::to_string(visibleCount));
+  if (cullingMode == CullingMode::Culled) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << static_cast<float>(indexTime) / 1000.f;
+    lines->push_back("Index: " + oss.str());
+  }
+}
+}  // namespace benchmark
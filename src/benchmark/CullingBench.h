@@ -0,0 +1,59 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+#include "SpatialGrid.h"
+
+namespace benchmark {
+
+enum class CullingMode { Unculled, Culled };
+
+/**
+ * CullingBench moves the particles in a world much larger than the screen while the camera pans
+ * over it, so most particles are off-screen at any time. The Unculled mode submits every particle
+ * and lets tgfx discard the invisible ones, while the Culled mode keeps the particles in a spatial
+ * grid updated as they move and submits only the visible ones.
+ */
+class CullingBench : public ParticleBench {
+ public:
+  explicit CullingBench(CullingMode mode);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+ private:
+  CullingMode cullingMode = CullingMode::Unculled;
+  tgfx::Rect worldRect = tgfx::Rect::MakeEmpty();
+  tgfx::Rect viewRect = tgfx::Rect::MakeEmpty();
+  float maxHalfSize = 0;
+  SpatialGrid grid = {};
+  std::vector<uint32_t> visibleIDs = {};
+  size_t visibleCount = 0;
+  int64_t frameIndex = 0;
+  int64_t indexTime = 0;
+};
+
+}  // namespace benchmark
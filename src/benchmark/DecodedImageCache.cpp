@@ -0,0 +1,52 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DecodedImageCache.h"
+
+namespace benchmark {
+void DecodedImageCache::addSource(const std::string& name, std::shared_ptr<tgfx::Image> image) {
+  if (image == nullptr) {
+    return;
+  }
+  sources[name] = std::move(image);
+}
+
+std::shared_ptr<tgfx::Image> DecodedImageCache::get(const std::string& name) {
+  std::lock_guard<std::mutex> autoLock(locker);
+  auto result = decodedImages.find(name);
+  if (result != decodedImages.end()) {
+    hits++;
+    return result->second;
+  }
+  auto source = sources.find(name);
+  if (source == sources.end()) {
+    return nullptr;
+  }
+  misses++;
+  auto image = source->second->makeDecoded();
+  decodedImages[name] = image;
+  return image;
+}
+
+void DecodedImageCache::clear() {
+  std::lock_guard<std::mutex> autoLock(locker);
+  decodedImages.clear();
+  hits = 0;
+  misses = 0;
+}
+}  // namespace benchmark
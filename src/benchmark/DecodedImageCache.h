@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "tgfx/core/Image.h"
+
+namespace benchmark {
+
+/**
+ * DecodedImageCache shares decoded images between render threads. Each source image is decoded
+ * once, by the first thread asking for it, and the decoded image is reused by every thread after
+ * that, so workers with separate contexts only upload the pixels instead of decoding them again.
+ */
+class DecodedImageCache {
+ public:
+  /**
+   * Adds a source image under the given name. Not thread-safe, call it before the workers start.
+   */
+  void addSource(const std::string& name, std::shared_ptr<tgfx::Image> image);
+
+  /**
+   * Returns the decoded image with the given name, decoding it on the first call. Returns nullptr
+   * if there is no such source image. Thread-safe.
+   */
+  std::shared_ptr<tgfx::Image> get(const std::string& name);
+
+  /**
+   * Drops the decoded images and resets the counters, keeping the source images.
+   */
+  void clear();
+
+  /**
+   * Returns the number of get() calls that found an already decoded image.
+   */
+  size_t hitCount() const {
+    return hits;
+  }
+
+  /**
+   * Returns the number of get() calls that had to decode the image.
+   */
+  size_t missCount() const {
+    return misses;
+  }
+
+ private:
+  std::mutex locker = {};
+  std::unordered_map<std::string, std::shared_ptr<tgfx::Image>> sources = {};
+  std::unordered_map<std::string, std::shared_ptr<tgfx::Image>> decodedImages = {};
+  std::atomic<size_t> hits = {0};
+  std::atomic<size_t> misses = {0};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,213 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ExportBench.h"
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Surface.h"
+
+namespace benchmark {
+static constexpr int EXPORT_WIDTH = 1280;
+static constexpr int EXPORT_HEIGHT = 720;
+static constexpr size_t SCENE_PARTICLES = 2000;
+static constexpr size_t FRAME_POOL_SIZE = 4;
+// The render stage stops for this display frame once it has used this much time.
+static constexpr int64_t RENDER_BUDGET = 12000;
+static constexpr int64_t RATE_INTERVAL = 1000000;
+
+static std::string ToString(YUVFormat format) {
+  switch (format) {
+    case YUVFormat::I420:
+      return "I420";
+    case YUVFormat::NV12:
+      return "NV12";
+    default:
+      return "Unknown";
+  }
+}
+
+ExportBench::ExportBench(YUVFormat format)
+    : ParticleBench("ExportBench-" + ToString(format), GraphicType::Rect), yuvFormat(format) {
+}
+
+ExportBench::~ExportBench() {
+  stopWorkers();
+}
+
+size_t ExportBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), SCENE_PARTICLES);
+}
+
+void ExportBench::onInit(const AppHost*) {
+  // The scene is fixed, the frame rate of each stage is the result.
+  drawCount = maxDrawCount();
+  stopWorkers();
+  startWorkers();
+}
+
+void ExportBench::onAnimate(const AppHost*) {
+  // The particles move once per exported frame in onDrawGraphics() instead of once per display
+  // frame.
+}
+
+void ExportBench::startWorkers() {
+  freeFrames = std::make_unique<BlockingQueue<ExportFrame*>>();
+  convertFrames = std::make_unique<BlockingQueue<ExportFrame*>>();
+  encodeFrames = std::make_unique<BlockingQueue<ExportFrame*>>();
+  framePool.clear();
+  for (size_t i = 0; i < FRAME_POOL_SIZE; i++) {
+    auto frame = std::make_unique<ExportFrame>();
+    frame->rgba.resize(static_cast<size_t>(EXPORT_WIDTH * EXPORT_HEIGHT * 4));
+    frame->yuv.resize(YUVByteSize(EXPORT_WIDTH, EXPORT_HEIGHT));
+    freeFrames->push(frame.get());
+    framePool.push_back(std::move(frame));
+  }
+  for (auto& stats : stageStats) {
+    stats.frames = 0;
+    stats.busyTime = 0;
+  }
+  for (int stage = Render; stage < StageCount; stage++) {
+    framesPerSecond[stage] = 0;
+    busyShares[stage] = 0;
+  }
+  rateStartTime = tgfx::Clock::Now();
+  convertThread = std::thread(&ExportBench::convertLoop, this);
+  encodeThread = std::thread(&ExportBench::encodeLoop, this);
+}
+
+void ExportBench::stopWorkers() {
+  if (!convertThread.joinable()) {
+    return;
+  }
+  // A null frame stops the converter, which passes it on to stop the encoder.
+  convertFrames->push(nullptr);
+  convertThread.join();
+  encodeThread.join();
+}
+
+void ExportBench::convertLoop() {
+  while (true) {
+    auto frame = convertFrames->pop();
+    if (frame == nullptr) {
+      encodeFrames->push(nullptr);
+      break;
+    }
+    auto startTime = tgfx::Clock::Now();
+    ConvertRGBAToYUV(frame->rgba.data(), static_cast<size_t>(EXPORT_WIDTH * 4), EXPORT_WIDTH,
+                     EXPORT_HEIGHT, yuvFormat, frame->yuv.data());
+    stageStats[Convert].busyTime += tgfx::Clock::Now() - startTime;
+    stageStats[Convert].frames++;
+    encodeFrames->push(frame);
+  }
+}
+
+void ExportBench::encodeLoop() {
+  while (true) {
+    auto frame = encodeFrames->pop();
+    if (frame == nullptr) {
+      break;
+    }
+    auto startTime = tgfx::Clock::Now();
+    // The stub sink reads every byte once, which is the least work a real encoder does.
+    uint64_t sum = 0;
+    auto bytes = frame->yuv.data();
+    auto wordCount = frame->yuv.size() / sizeof(uint64_t);
+    for (size_t i = 0; i < wordCount; i++) {
+      uint64_t word = 0;
+      memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+      sum += word;
+    }
+    checksum += sum;
+    stageStats[Encode].busyTime += tgfx::Clock::Now() - startTime;
+    stageStats[Encode].frames++;
+    freeFrames->push(frame);
+  }
+}
+
+void ExportBench::updateRates() {
+  auto currentTime = tgfx::Clock::Now();
+  auto elapsedTime = currentTime - rateStartTime;
+  if (elapsedTime < RATE_INTERVAL) {
+    return;
+  }
+  for (int stage = Render; stage < StageCount; stage++) {
+    auto& stats = stageStats[stage];
+    framesPerSecond[stage] =
+        static_cast<float>(stats.frames.exchange(0)) * 1000000.f / static_cast<float>(elapsedTime);
+    busyShares[stage] =
+        static_cast<float>(stats.busyTime.exchange(0)) / static_cast<float>(elapsedTime);
+  }
+  rateStartTime = currentTime;
+}
+
+void ExportBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) {
+  auto windowSurface = canvas->getSurface();
+  if (windowSurface == nullptr || windowSurface->getContext() == nullptr) {
+    return;
+  }
+  auto context = windowSurface->getContext();
+  if (surface == nullptr || surface->getContext() != context) {
+    surface = tgfx::Surface::Make(context, EXPORT_WIDTH, EXPORT_HEIGHT);
+    if (surface == nullptr) {
+      return;
+    }
+  }
+  auto info = tgfx::ImageInfo::Make(EXPORT_WIDTH, EXPORT_HEIGHT, tgfx::ColorType::RGBA_8888);
+  auto budgetStart = tgfx::Clock::Now();
+  ExportFrame* frame = nullptr;
+  // Renders export frames until the budget is used up or all buffers are busy downstream.
+  while (tgfx::Clock::Now() - budgetStart < RENDER_BUDGET && freeFrames->tryPop(&frame)) {
+    auto startTime = tgfx::Clock::Now();
+    ParticleBench::onAnimate(host);
+    auto exportCanvas = surface->getCanvas();
+    exportCanvas->clear(tgfx::Color::White());
+    exportCanvas->save();
+    exportCanvas->scale(static_cast<float>(EXPORT_WIDTH) / width,
+                        static_cast<float>(EXPORT_HEIGHT) / height);
+    ParticleBench::onDrawGraphics(exportCanvas, host);
+    exportCanvas->restore();
+    if (!surface->readPixels(info, frame->rgba.data())) {
+      freeFrames->push(frame);
+      break;
+    }
+    stageStats[Render].busyTime += tgfx::Clock::Now() - startTime;
+    stageStats[Render].frames++;
+    convertFrames->push(frame);
+  }
+  updateRates();
+  // Shows the scene of the last exported frame in the window.
+  ParticleBench::onDrawGraphics(canvas, host);
+}
+
+void ExportBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  static const char* stageNames[] = {"Render", "Convert", "Encode"};
+  int bottleneck = Render;
+  for (int stage = Render; stage < StageCount; stage++) {
+    if (busyShares[stage] > busyShares[bottleneck]) {
+      bottleneck = stage;
+    }
+    std::ostringstream oss;
+    oss << stageNames[stage] << ": " << std::fixed << std::setprecision(0)
+        << framesPerSecond[stage] << "/s " << busyShares[stage] * 100.f << "%";
+    lines->push_back(oss.str());
+  }
+  lines->push_back(std::string("Bottleneck: ") + stageNames[bottleneck]);
+}
+}  // namespace benchmark
@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include "ParticleBench.h"
+#include "YUVConverter.h"
+#include "base/BlockingQueue.h"
+
+namespace benchmark {
+
+/**
+ * ExportBench mirrors rendering an animation to video. The window thread renders particle frames
+ * into an offscreen surface and reads them back, a converter thread turns them into YUV 4:2:0
+ * with a SIMD kernel, and an encoder thread consumes them in a stub sink. The stages pass a small
+ * pool of frame buffers through blocking queues. The status bar shows the frames per second and
+ * busy share of each stage, and the render stage renders as many frames per display frame as the
+ * pool allows, so the busiest stage is the bottleneck and the others stall waiting on it.
+ * Only available on native platforms.
+ */
+class ExportBench : public ParticleBench {
+ public:
+  explicit ExportBench(YUVFormat format);
+
+  ~ExportBench() override;
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+  bool isDeterministic() const override {
+    return false;
+  }
+
+ private:
+  enum Stage { Render, Convert, Encode, StageCount };
+
+  struct ExportFrame {
+    std::vector<uint8_t> rgba = {};
+    std::vector<uint8_t> yuv = {};
+  };
+
+  struct StageStats {
+    std::atomic<int64_t> frames = {0};
+    std::atomic<int64_t> busyTime = {0};
+  };
+
+  void startWorkers();
+
+  void stopWorkers();
+
+  void convertLoop();
+
+  void encodeLoop();
+
+  void updateRates();
+
+  YUVFormat yuvFormat = YUVFormat::I420;
+  std::shared_ptr<tgfx::Surface> surface = nullptr;
+  std::vector<std::unique_ptr<ExportFrame>> framePool = {};
+  std::unique_ptr<BlockingQueue<ExportFrame*>> freeFrames = nullptr;
+  std::unique_ptr<BlockingQueue<ExportFrame*>> convertFrames = nullptr;
+  std::unique_ptr<BlockingQueue<ExportFrame*>> encodeFrames = nullptr;
+  std::thread convertThread = {};
+  std::thread encodeThread = {};
+  StageStats stageStats[StageCount] = {};
+  std::atomic<uint64_t> checksum = {0};
+  int64_t rateStartTime = 0;
+  float framesPerSecond[StageCount] = {};
+  float busyShares[StageCount] = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ImageFilterBench.h"
+#include <iomanip>
+#include <sstream>
+
+namespace benchmark {
+static constexpr float BLUR_RADII[] = {2.f, 4.f, 8.f, 16.f};
+static constexpr size_t RADIUS_COUNT = sizeof(BLUR_RADII) / sizeof(BLUR_RADII[0]);
+static constexpr size_t MAX_FILTERED_DRAW_COUNT = 20000;
+
+static std::string ToString(ImageFilterType type) {
+  switch (type) {
+    case ImageFilterType::Blur:
+      return "Blur";
+    case ImageFilterType::DropShadow:
+      return "DropShadow";
+    case ImageFilterType::Compose:
+      return "Compose";
+    default:
+      return "Unknown";
+  }
+}
+
+ImageFilterBench::ImageFilterBench(ImageFilterType type)
+    : ParticleBench("ImageFilterBench-" + ToString(type), GraphicType::RRect), filterType(type) {
+}
+
+std::shared_ptr<tgfx::ImageFilter> ImageFilterBench::makeFilter(float radius) const {
+  auto shadowColor = tgfx::Color{0.f, 0.f, 0.f, 0.5f};
+  switch (filterType) {
+    case ImageFilterType::Blur:
+      return tgfx::ImageFilter::Blur(radius, radius);
+    case ImageFilterType::DropShadow:
+      return tgfx::ImageFilter::DropShadow(0, radius * 0.5f, radius, radius, shadowColor);
+    case ImageFilterType::Compose: {
+      auto blur = tgfx::ImageFilter::Blur(radius * 0.25f, radius * 0.25f);
+      auto shadow = tgfx::ImageFilter::DropShadow(0, radius * 0.5f, radius, radius, shadowColor);
+      return tgfx::ImageFilter::Compose(std::move(blur), std::move(shadow));
+    }
+    default:
+      return nullptr;
+  }
+}
+
+void ImageFilterBench::onInit(const AppHost* host) {
+  filterPaints.clear();
+  for (size_t i = 0; i < RADIUS_COUNT; i++) {
+    auto filter = makeFilter(BLUR_RADII[i] * host->density());
+    for (auto& paint : paints) {
+      auto filterPaint = paint;
+      filterPaint.setImageFilter(filter);
+      filterPaints.push_back(filterPaint);
+    }
+  }
+}
+
+void ImageFilterBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  for (size_t i = 0; i < drawCount; i++) {
+    auto& rect = graphics[i].rect;
+    auto& paint = filterPaints[(i % RADIUS_COUNT) * 3 + i % 3];
+    const float radius = rect.width() * 0.25f;
+    canvas->drawRoundRect(rect, radius, radius, paint);
+  }
+  canvas->drawRect(startRect, {});
+}
+
+void ImageFilterBench::onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) {
+  std::ostringstream oss;
+  auto drawTime = static_cast<double>(host->averageDrawTime()) / static_cast<double>(drawCount);
+  oss << std::fixed << std::setprecision(2) << drawTime;
+  lines->push_back("Draw: " + oss.str() + "us");
+  // The peak of the whole resource cache since the last reset, which includes the intermediate
+  // textures of the filters along with every other resource of the context.
+  oss.str("");
+  auto peakMemoryUsage = static_cast<double>(host->peakGPUMemoryUsage());
+  oss << std::fixed << std::setprecision(1) << peakMemoryUsage / 1048576.0;
+  lines->push_back("GPU Peak: " + oss.str() + "MB");
+}
+
+size_t ImageFilterBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), MAX_FILTERED_DRAW_COUNT);
+}
+}  // namespace benchmark
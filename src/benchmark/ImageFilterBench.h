@@ -0,0 +1,54 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+#include "tgfx/core/ImageFilter.h"
+
+namespace benchmark {
+
+enum class ImageFilterType { Blur, DropShadow, Compose };
+
+/**
+ * ImageFilterBench draws rounded-rect particles that each carry an image filter, so every draw
+ * needs an offscreen render pass. The blur radius varies between particles. The status bar adds
+ * the peak GPU memory of the context since the last reset, which covers the whole resource cache
+ * rather than the filter textures alone.
+ */
+class ImageFilterBench : public ParticleBench {
+ public:
+  explicit ImageFilterBench(ImageFilterType type);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+ private:
+  std::shared_ptr<tgfx::ImageFilter> makeFilter(float radius) const;
+
+  ImageFilterType filterType = ImageFilterType::Blur;
+  std::vector<tgfx::Paint> filterPaints = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LayerTreeBench.h"
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Surface.h"
+#include "tgfx/layers/ImageLayer.h"
+#include "tgfx/layers/ShapeLayer.h"
+#include "tgfx/layers/SolidColor.h"
+#include "tgfx/layers/TextLayer.h"
+
+namespace benchmark {
+static constexpr size_t MAX_LAYER_COUNT = 100000;
+// Leaves are grouped by LEAVES_PER_GROUP, and groups by GROUPS_PER_SECTION.
+static constexpr size_t LEAVES_PER_GROUP = 100;
+static constexpr size_t GROUPS_PER_SECTION = 10;
+
+static float AnimatedFraction = 0.05f;
+
+static std::string ToString(tgfx::RenderMode mode) {
+  switch (mode) {
+    case tgfx::RenderMode::Direct:
+      return "Full";
+    case tgfx::RenderMode::Partial:
+      return "Partial";
+    default:
+      return "Unknown";
+  }
+}
+
+LayerTreeBench::LayerTreeBench(tgfx::RenderMode mode)
+    : ParticleBench("LayerTreeBench-" + ToString(mode), GraphicType::RRect), renderMode(mode) {
+  displayList.setRenderMode(renderMode);
+}
+
+void LayerTreeBench::SetAnimatedFraction(float fraction) {
+  AnimatedFraction = std::max(0.f, std::min(fraction, 1.f));
+}
+
+void LayerTreeBench::onInit(const AppHost* host) {
+  displayList.root()->removeChildren();
+  groups.clear();
+  leaves.clear();
+  auto maxCount = maxDrawCount();
+  for (size_t i = 0; i < maxCount; i++) {
+    auto& rect = graphics[i].rect;
+    auto x = (graphics[i].speedX / 10.f + 0.5f) * width;
+    auto y = (graphics[i].speedY / 10.f + 0.5f) * height;
+    rect.offsetTo(x - rect.width() * 0.5f, y - rect.height() * 0.5f);
+  }
+  image = host->getImage("bridge");
+  if (image != nullptr) {
+    image = image->makeMipmapped(true);
+  }
+  font = tgfx::Font(host->getTypeface("default"), 12.f * host->density());
+  animatedOffset = 0;
+  updateTime = 0;
+  renderTime = 0;
+}
+
+void LayerTreeBench::addLeafLayers() {
+  static const tgfx::Color colors[] = {tgfx::Color::Red(), tgfx::Color::Green(),
+                                       tgfx::Color::Blue()};
+  for (auto i = leaves.size(); i < drawCount; i++) {
+    auto groupIndex = i / LEAVES_PER_GROUP;
+    if (groupIndex >= groups.size()) {
+      auto group = tgfx::Layer::Make();
+      if (groupIndex % GROUPS_PER_SECTION == 0) {
+        displayList.root()->addChild(group);
+      } else {
+        groups[groupIndex - groupIndex % GROUPS_PER_SECTION]->addChild(group);
+      }
+      groups.push_back(group);
+    }
+    auto& rect = graphics[i].rect;
+    std::shared_ptr<tgfx::Layer> leaf = nullptr;
+    switch (i % 3) {
+      case 0: {
+        auto shapeLayer = tgfx::ShapeLayer::Make();
+        tgfx::Path path = {};
+        auto localRect = tgfx::Rect::MakeWH(rect.width(), rect.height());
+        path.addRoundRect(localRect, rect.width() * 0.25f, rect.width() * 0.25f);
+        shapeLayer->setPath(path);
+        shapeLayer->setFillStyle(tgfx::SolidColor::Make(colors[i / 3 % 3]));
+        leaf = shapeLayer;
+        break;
+      }
+      case 1: {
+        auto imageLayer = tgfx::ImageLayer::Make();
+        imageLayer->setImage(image);
+        leaf = imageLayer;
+        break;
+      }
+      default: {
+        auto textLayer = tgfx::TextLayer::Make();
+        textLayer->setText(std::to_string(i % 100));
+        textLayer->setFont(font);
+        textLayer->setTextColor(colors[i / 3 % 3]);
+        leaf = textLayer;
+        break;
+      }
+    }
+    auto matrix = tgfx::Matrix::MakeTrans(rect.left, rect.top);
+    if (i % 3 == 1 && image != nullptr) {
+      matrix.preScale(rect.width() / static_cast<float>(image->width()),
+                      rect.height() / static_cast<float>(image->height()));
+    }
+    leaf->setMatrix(matrix);
+    groups[groupIndex]->addChild(leaf);
+    leaves.push_back(leaf);
+  }
+}
+
+void LayerTreeBench::onAnimate(const AppHost*) {
+  auto startTime = tgfx::Clock::Now();
+  addLeafLayers();
+  auto animatedCount =
+      static_cast<size_t>(std::ceil(static_cast<float>(drawCount) * AnimatedFraction));
+  for (size_t j = 0; j < animatedCount; j++) {
+    auto i = (animatedOffset + j) % drawCount;
+    auto& graphic = graphics[i];
+    auto& rect = graphic.rect;
+    // The leaf moves by the same delta as its rect, before a bounce flips the speed.
+    auto deltaX = graphic.speedX;
+    auto deltaY = graphic.speedY;
+    rect.offset(deltaX, deltaY);
+    if (rect.right <= 0 || rect.left >= width) {
+      graphic.speedX = -graphic.speedX;
+    }
+    if (rect.bottom <= 0 || rect.top >= height) {
+      graphic.speedY = -graphic.speedY;
+    }
+    auto matrix = leaves[i]->matrix();
+    matrix.postTranslate(deltaX, deltaY);
+    leaves[i]->setMatrix(matrix);
+  }
+  // Move a different slice of the leaves in every frame.
+  animatedOffset = (animatedOffset + animatedCount) % drawCount;
+  updateTime = tgfx::Clock::Now() - startTime;
+}
+
+void LayerTreeBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  auto surface = canvas->getSurface();
+  if (surface == nullptr) {
+    return;
+  }
+  auto startTime = tgfx::Clock::Now();
+  displayList.render(surface, false);
+  renderTime = tgfx::Clock::Now() - startTime;
+}
+
+void LayerTreeBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1) << static_cast<float>(updateTime) / 1000.f;
+  lines->push_back("Update: " + oss.str());
+  oss.str("");
+  oss << std::fixed << std::setprecision(1) << static_cast<float>(renderTime) / 1000.f;
+  lines->push_back("Render: " + oss.str());
+}
+
+size_t LayerTreeBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), MAX_LAYER_COUNT);
+}
+}  // namespace benchmark
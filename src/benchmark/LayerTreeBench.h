@@ -0,0 +1,67 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+#include "tgfx/layers/DisplayList.h"
+
+namespace benchmark {
+
+/**
+ * LayerTreeBench builds a retained layer tree of shape, image and text layers in nested groups and
+ * renders it with a DisplayList. Each particle is one leaf layer, and only a fraction of the leaves
+ * move every frame, so the Partial mode can redraw the dirty regions alone while the Full mode
+ * redraws everything.
+ */
+class LayerTreeBench : public ParticleBench {
+ public:
+  explicit LayerTreeBench(tgfx::RenderMode mode);
+
+  /**
+   * Sets the fraction of leaf layers that move every frame, in the range [0, 1]. The default value
+   * is 0.05.
+   */
+  static void SetAnimatedFraction(float fraction);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+ private:
+  void addLeafLayers();
+
+  tgfx::RenderMode renderMode = tgfx::RenderMode::Direct;
+  tgfx::DisplayList displayList = {};
+  std::vector<std::shared_ptr<tgfx::Layer>> groups = {};
+  std::vector<std::shared_ptr<tgfx::Layer>> leaves = {};
+  std::shared_ptr<tgfx::Image> image = nullptr;
+  tgfx::Font font = {};
+  size_t animatedOffset = 0;
+  int64_t updateTime = 0;
+  int64_t renderTime = 0;
+};
+
+}  // namespace benchmark
@@ -0,0 +1,287 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MultiContextBench.h"
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Surface.h"
+#include "tgfx/gpu/opengl/GLDevice.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+static constexpr int SCENE_SIZE = 512;
+static constexpr size_t SCENE_PARTICLES = 5000;
+static constexpr int64_t STEP_DURATION = 3000000;
+// Workers pause when the window has not drawn this bench for a while, e.g. after switching away.
+static constexpr int64_t IDLE_TIMEOUT = 500000;
+// Workers wait for the GPU every few frames, so the frame rate counts finished frames rather than
+// frames queued up in the driver.
+static constexpr int64_t SYNC_INTERVAL = 4;
+
+static size_t MaxThreadCount = 8;
+
+static std::string ToString(ContextMode mode) {
+  switch (mode) {
+    case ContextMode::Separate:
+      return "Separate";
+    case ContextMode::Shared:
+      return "Shared";
+    default:
+      return "Unknown";
+  }
+}
+
+MultiContextBench::MultiContextBench(ContextMode mode)
+    : ParticleBench("MultiContextBench-" + ToString(mode), GraphicType::Rect), contextMode(mode) {
+}
+
+MultiContextBench::~MultiContextBench() {
+  stopWorkers();
+}
+
+void MultiContextBench::SetMaxThreadCount(int count) {
+  MaxThreadCount = static_cast<size_t>(std::max(count, 1));
+}
+
+size_t MultiContextBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), SCENE_PARTICLES);
+}
+
+void MultiContextBench::onInit(const AppHost*) {
+  stopWorkers();
+  // Every worker renders a scene of the same fixed size, so there is nothing to ramp up.
+  drawCount = maxDrawCount();
+  results.clear();
+  for (size_t threadCount = 1; threadCount < MaxThreadCount; threadCount *= 2) {
+    results.push_back({threadCount, 0, 0, false});
+  }
+  results.push_back({MaxThreadCount, 0, 0, false});
+  stepIndex = 0;
+}
+
+void MultiContextBench::onAnimate(const AppHost*) {
+  auto currentTime = tgfx::Clock::Now();
+  if (currentTime - lastActiveTime > IDLE_TIMEOUT) {
+    // The workers have been idle, restart the current step to keep its result accurate.
+    stopWorkers();
+  }
+  lastActiveTime = currentTime;
+  if (workers.empty()) {
+    if (!results[stepIndex].failed && !startWorkers(results[stepIndex].threadCount)) {
+      failStep();
+    }
+    return;
+  }
+  if (failedWorkers > 0) {
+    failStep();
+    return;
+  }
+  if (!stepStarted) {
+    if (readyWorkers < workers.size()) {
+      return;
+    }
+    // Every worker has created its device and surface, so only rendering is timed from here.
+    stepStartTime = currentTime;
+    stepStarted = true;
+    return;
+  }
+  auto elapsedTime = currentTime - stepStartTime;
+  if (elapsedTime <= 0) {
+    return;
+  }
+  auto& result = results[stepIndex];
+  auto totalWorkTime = workTime.load();
+  result.framesPerSecond =
+      static_cast<float>(frameCount.load()) * 1000000.f / static_cast<float>(elapsedTime);
+  result.lockWaitShare = totalWorkTime > 0 ? static_cast<float>(lockWaitTime.load()) /
+                                                 static_cast<float>(totalWorkTime)
+                                           : 0.f;
+  if (elapsedTime >= STEP_DURATION) {
+    // The next step starts in the following frame.
+    stopWorkers();
+    nextStep();
+  }
+}
+
+void MultiContextBench::failStep() {
+  stopWorkers();
+  auto& result = results[stepIndex];
+  tgfx::PrintError("MultiContextBench::onAnimate() the step with %zu threads failed!",
+                   result.threadCount);
+  result.failed = true;
+  result.framesPerSecond = 0;
+  nextStep();
+}
+
+void MultiContextBench::nextStep() {
+  // Failed steps are skipped, and once every step has failed the bench stays idle.
+  for (size_t i = 0; i < results.size(); i++) {
+    stepIndex = (stepIndex + 1) % results.size();
+    if (!results[stepIndex].failed) {
+      return;
+    }
+  }
+}
+
+void MultiContextBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  // Draws the frames per second of each step as a bar chart.
+  float maxFPS = 1.f;
+  for (auto& result : results) {
+    maxFPS = std::max(maxFPS, result.framesPerSecond);
+  }
+  auto barWidth = width / static_cast<float>(results.size() * 2 + 1);
+  auto maxBarHeight = height * 0.6f;
+  for (size_t i = 0; i < results.size(); i++) {
+    auto barHeight = maxBarHeight * results[i].framesPerSecond / maxFPS;
+    auto left = barWidth * static_cast<float>(i * 2 + 1);
+    auto rect = tgfx::Rect::MakeLTRB(left, height - barHeight, left + barWidth, height);
+    canvas->drawRect(rect, paints[i == stepIndex ? 1 : 2]);
+  }
+}
+
+void MultiContextBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  std::ostringstream oss;
+  auto& current = results[stepIndex];
+  lines->push_back("Threads: " + std::to_string(current.threadCount));
+  oss << std::fixed << std::setprecision(1) << current.lockWaitShare * 100.f;
+  lines->push_back("Lock Wait: " + oss.str() + "%");
+  for (auto& result : results) {
+    oss.str("");
+    oss << std::fixed << std::setprecision(0) << result.framesPerSecond;
+    if (result.failed) {
+      lines->push_back("K" + std::to_string(result.threadCount) + ": failed");
+      continue;
+    }
+    lines->push_back("K" + std::to_string(result.threadCount) + ": " + oss.str() + " fps");
+  }
+}
+
+bool MultiContextBench::startWorkers(size_t threadCount) {
+  exiting = false;
+  stepStarted = false;
+  readyWorkers = 0;
+  failedWorkers = 0;
+  frameCount = 0;
+  lockWaitTime = 0;
+  workTime = 0;
+  if (contextMode == ContextMode::Shared) {
+    sharedDevice = tgfx::GLDevice::Make();
+    if (sharedDevice == nullptr) {
+      tgfx::PrintError("MultiContextBench::startWorkers() failed to create the shared device!");
+      return false;
+    }
+  }
+  for (size_t i = 0; i < threadCount; i++) {
+    workers.emplace_back(&MultiContextBench::workerLoop, this, i, drawCount);
+  }
+  return true;
+}
+
+void MultiContextBench::stopWorkers() {
+  exiting = true;
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  workers.clear();
+  sharedDevice = nullptr;
+}
+
+void MultiContextBench::workerLoop(size_t index, size_t particleCount) {
+  auto device = sharedDevice;
+  if (device == nullptr) {
+    device = tgfx::GLDevice::Make();
+  }
+  if (device == nullptr) {
+    tgfx::PrintError("MultiContextBench::workerLoop() failed to create the device!");
+    failedWorkers++;
+    return;
+  }
+  std::vector<GraphicData> particles(particleCount);
+  std::mt19937 rng(static_cast<unsigned>(index));
+  std::uniform_real_distribution<float> distribution(0, 1);
+  for (auto& particle : particles) {
+    auto size = 4.f + distribution(rng) * 10.f;
+    particle.rect.setXYWH(distribution(rng) * SCENE_SIZE, distribution(rng) * SCENE_SIZE, size,
+                          size);
+    particle.speedX = (distribution(rng) * 2.f - 1.f) * 5.f;
+    particle.speedY = (distribution(rng) * 2.f - 1.f) * 5.f;
+  }
+  tgfx::Paint workerPaints[3];
+  for (int i = 0; i < 3; i++) {
+    tgfx::Color color = tgfx::Color::Black();
+    color[i] = 1.f;
+    workerPaints[i].setColor(color);
+  }
+  std::shared_ptr<tgfx::Surface> surface = nullptr;
+  auto context = device->lockContext();
+  if (context != nullptr) {
+    surface = tgfx::Surface::Make(context, SCENE_SIZE, SCENE_SIZE);
+    device->unlock();
+  }
+  if (surface == nullptr) {
+    tgfx::PrintError("MultiContextBench::workerLoop() failed to create the surface!");
+    failedWorkers++;
+    return;
+  }
+  readyWorkers++;
+  while (!exiting && !stepStarted) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  int64_t workerFrames = 0;
+  while (!exiting) {
+    auto startTime = tgfx::Clock::Now();
+    if (startTime - lastActiveTime > IDLE_TIMEOUT) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      continue;
+    }
+    context = device->lockContext();
+    auto lockedTime = tgfx::Clock::Now();
+    if (context == nullptr) {
+      tgfx::PrintError("MultiContextBench::workerLoop() failed to lock the context!");
+      failedWorkers++;
+      break;
+    }
+    auto canvas = surface->getCanvas();
+    canvas->clear();
+    for (size_t i = 0; i < particles.size(); i++) {
+      auto& particle = particles[i];
+      auto& rect = particle.rect;
+      if (rect.left < 0 || rect.right > SCENE_SIZE) {
+        particle.speedX = -particle.speedX;
+      }
+      if (rect.top < 0 || rect.bottom > SCENE_SIZE) {
+        particle.speedY = -particle.speedY;
+      }
+      rect.offset(particle.speedX, particle.speedY);
+      canvas->drawRect(rect, workerPaints[i % 3]);
+    }
+    workerFrames++;
+    context->flushAndSubmit(workerFrames % SYNC_INTERVAL == 0);
+    device->unlock();
+    frameCount++;
+    lockWaitTime += lockedTime - startTime;
+    workTime += tgfx::Clock::Now() - startTime;
+  }
+  if (surface != nullptr && device->lockContext() != nullptr) {
+    surface = nullptr;
+    device->unlock();
+  }
+}
+}  // namespace benchmark
@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include "ParticleBench.h"
+#include "tgfx/gpu/Device.h"
+
+namespace benchmark {
+
+enum class ContextMode { Separate, Shared };
+
+/**
+ * MultiContextBench renders independent particle scenes to offscreen surfaces on K worker threads
+ * and reports the aggregate frames per second. In the Separate mode each thread creates its own
+ * device, while in the Shared mode all threads render through one device and take turns with
+ * lockContext() and unlock(). K steps through 1, 2, 4, ... up to the value set by
+ * SetMaxThreadCount(), a few seconds each, and the window shows the result of every step. Each
+ * step is timed once all of its workers have created their devices and surfaces, and a step whose
+ * workers fail is marked as failed and skipped from then on. Only available on native platforms.
+ */
+class MultiContextBench : public ParticleBench {
+ public:
+  explicit MultiContextBench(ContextMode mode);
+
+  ~MultiContextBench() override;
+
+  /**
+   * Sets the largest number of worker threads to step through. The default value is 8.
+   */
+  static void SetMaxThreadCount(int count);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+  bool isDeterministic() const override {
+    return false;
+  }
+
+ private:
+  struct StepResult {
+    size_t threadCount = 0;
+    float framesPerSecond = 0;
+    float lockWaitShare = 0;
+    bool failed = false;
+  };
+
+  bool startWorkers(size_t threadCount);
+
+  void failStep();
+
+  void nextStep();
+
+  void stopWorkers();
+
+  void workerLoop(size_t index, size_t particleCount);
+
+  ContextMode contextMode = ContextMode::Separate;
+  std::shared_ptr<tgfx::Device> sharedDevice = nullptr;
+  std::vector<std::thread> workers = {};
+  std::atomic<bool> exiting = {false};
+  std::atomic<int64_t> lastActiveTime = {0};
+  std::atomic<bool> stepStarted = {false};
+  std::atomic<size_t> readyWorkers = {0};
+  std::atomic<size_t> failedWorkers = {0};
+  std::atomic<int64_t> frameCount = {0};
+  std::atomic<int64_t> lockWaitTime = {0};
+  std::atomic<int64_t> workTime = {0};
+  std::vector<StepResult> results = {};
+  size_t stepIndex = 0;
+  int64_t stepStartTime = 0;
+};
+
+}  // namespace benchmark
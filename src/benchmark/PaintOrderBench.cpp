@@ -0,0 +1,160 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PaintOrderBench.h"
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Shader.h"
+
+namespace benchmark {
+// The bits of a paint index that select its pipeline state, giving 16 distinct states.
+static constexpr size_t PAINT_STATE_GRADIENT = 1;
+static constexpr size_t PAINT_STATE_SCREEN = 2;
+static constexpr size_t PAINT_STATE_STROKE = 4;
+static constexpr size_t PAINT_STATE_NO_AA = 8;
+
+static int PaintCount = 64;
+
+static std::string ToString(DrawOrder order) {
+  switch (order) {
+    case DrawOrder::Interleaved:
+      return "Interleaved";
+    case DrawOrder::Sorted:
+      return "Sorted";
+    case DrawOrder::Random:
+      return "Random";
+    default:
+      return "Unknown";
+  }
+}
+
+// Returns a fully saturated color with the given hue in [0, 1).
+static tgfx::Color HueToColor(float hue) {
+  auto h = hue * 6.f;
+  auto x = 1.f - std::fabs(std::fmod(h, 2.f) - 1.f);
+  switch (static_cast<int>(h)) {
+    case 0:
+      return {1.f, x, 0.f, 1.f};
+    case 1:
+      return {x, 1.f, 0.f, 1.f};
+    case 2:
+      return {0.f, 1.f, x, 1.f};
+    case 3:
+      return {0.f, x, 1.f, 1.f};
+    case 4:
+      return {x, 0.f, 1.f, 1.f};
+    default:
+      return {1.f, 0.f, x, 1.f};
+  }
+}
+
+PaintOrderBench::PaintOrderBench(DrawOrder order)
+    : ParticleBench("PaintOrderBench-" + ToString(order), GraphicType::Rect), drawOrder(order) {
+}
+
+void PaintOrderBench::SetPaintCount(int count) {
+  PaintCount = std::max(count, 1);
+}
+
+void PaintOrderBench::onInit(const AppHost* host) {
+  auto paintCount = static_cast<size_t>(PaintCount);
+  orderPaints.resize(paintCount);
+  for (size_t i = 0; i < paintCount; i++) {
+    // A solid color travels with each draw and never splits a batch, so the low bits of the index
+    // pick the state that changes the pipeline: the shader, the blend mode, the style and the
+    // anti-aliasing. The color only varies on top of that.
+    auto color = HueToColor(static_cast<float>(i) / static_cast<float>(paintCount));
+    auto& paint = orderPaints[i];
+    paint = {};
+    paint.setColor(color);
+    if ((i & PAINT_STATE_GRADIENT) != 0) {
+      paint.setShader(tgfx::Shader::MakeLinearGradient(
+          tgfx::Point::Make(0, 0), tgfx::Point::Make(width, height),
+          {color, tgfx::Color{1.f - color.red, 1.f - color.green, 1.f - color.blue, 1.f}}, {}));
+    }
+    paint.setBlendMode((i & PAINT_STATE_SCREEN) != 0 ? tgfx::BlendMode::Screen
+                                                     : tgfx::BlendMode::SrcOver);
+    if ((i & PAINT_STATE_STROKE) != 0) {
+      paint.setStyle(tgfx::PaintStyle::Stroke);
+      paint.setStrokeWidth(2.f * host->density());
+    } else {
+      paint.setStyle(tgfx::PaintStyle::Fill);
+    }
+    paint.setAntiAlias((i & PAINT_STATE_NO_AA) == 0);
+  }
+  auto maxCount = maxDrawCount();
+  paintIndices.resize(maxCount);
+  if (drawOrder == DrawOrder::Random) {
+    std::mt19937 paintRng(90);
+    std::uniform_int_distribution<uint32_t> distribution(0, static_cast<uint32_t>(paintCount - 1));
+    for (auto& paintIndex : paintIndices) {
+      paintIndex = distribution(paintRng);
+    }
+  } else {
+    for (size_t i = 0; i < maxCount; i++) {
+      paintIndices[i] = static_cast<uint32_t>(i % paintCount);
+    }
+  }
+  sortedIndices.clear();
+  paintOffsets.assign(paintCount + 1, 0);
+  sortTime = 0;
+}
+
+void PaintOrderBench::sortByPaint() {
+  // A counting sort, stable and linear in the number of particles.
+  auto startTime = tgfx::Clock::Now();
+  std::fill(paintOffsets.begin(), paintOffsets.end(), 0);
+  for (size_t i = 0; i < drawCount; i++) {
+    paintOffsets[paintIndices[i] + 1]++;
+  }
+  for (size_t i = 1; i < paintOffsets.size(); i++) {
+    paintOffsets[i] += paintOffsets[i - 1];
+  }
+  sortedIndices.resize(drawCount);
+  for (size_t i = 0; i < drawCount; i++) {
+    sortedIndices[paintOffsets[paintIndices[i]]++] = static_cast<uint32_t>(i);
+  }
+  sortTime = tgfx::Clock::Now() - startTime;
+}
+
+void PaintOrderBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  if (drawOrder == DrawOrder::Sorted) {
+    sortByPaint();
+    for (auto index : sortedIndices) {
+      canvas->drawRect(graphics[index].rect, orderPaints[paintIndices[index]]);
+    }
+  } else {
+    for (size_t i = 0; i < drawCount; i++) {
+      canvas->drawRect(graphics[i].rect, orderPaints[paintIndices[i]]);
+    }
+  }
+  canvas->drawRect(startRect, {});
+}
+
+void PaintOrderBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  lines->push_back("Paints: " + std::to_string(PaintCount));
+  if (drawOrder == DrawOrder::Sorted) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << static_cast<float>(sortTime) / 1000.f;
+    lines->push_back("Sort: " + oss.str());
+  }
+}
+}  // namespace benchmark
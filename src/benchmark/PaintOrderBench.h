@@ -0,0 +1,62 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+enum class DrawOrder { Interleaved, Sorted, Random };
+
+/**
+ * PaintOrderBench draws the particles with a configurable number of distinct paints in different
+ * orders, to measure how op batching copes with paint changes. The paints cycle through 16
+ * pipeline states, solid or gradient shader, SrcOver or Screen blending, fill or stroke and
+ * anti-aliasing on or off, with a different color for each paint. The Interleaved order changes
+ * the paint on every draw, the Sorted order groups the draws by paint with a sort in every frame,
+ * and the Random order assigns the paints randomly.
+ */
+class PaintOrderBench : public ParticleBench {
+ public:
+  explicit PaintOrderBench(DrawOrder order);
+
+  /**
+   * Sets the number of distinct paints. The default value is 64.
+   */
+  static void SetPaintCount(int count);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+ private:
+  void sortByPaint();
+
+  DrawOrder drawOrder = DrawOrder::Interleaved;
+  std::vector<tgfx::Paint> orderPaints = {};
+  std::vector<uint32_t> paintIndices = {};
+  std::vector<uint32_t> sortedIndices = {};
+  std::vector<uint32_t> paintOffsets = {};
+  int64_t sortTime = 0;
+};
+
+}  // namespace benchmark
@@ -21,13 +21,20 @@
 #include <iomanip>
 #include <random>
 #include <sstream>
-#include "tgfx/core/Clock.h"
+#include "base/FrameValidator.h"
+#include "base/MemoryTracker.h"
+#include "tgfx/platform/Print.h"
 
 namespace benchmark {
 static constexpr int64_t FLUSH_INTERVAL = 300000;
 static constexpr float FPS_BACKGROUND_HEIGHT = 50.f;
 static constexpr float STATUS_WIDTH = 250.f;
 static constexpr float FONT_SIZE = 40.f;
+// The number of particles drawn until the last frame sampled by FrameValidator.
+static constexpr size_t VALIDATION_DRAW_COUNT = 1000;
+// The number of frames after a reset before an unchanged frame counts as a steady-state frame.
+static constexpr int64_t STEADY_WARM_UP_FRAMES = 30;
+static constexpr float BYTES_PER_MB = 1024.f * 1024.f;
 
 static bool DrawStatusFlag = true;
 static size_t InitDrawCount = 1;
@@ -59,11 +66,59 @@ ParticleBench::ParticleBench(GraphicType type)
     : Bench("ParticleBench-" + ToString(type)), graphicType(type) {
 }
 
+ParticleBench::ParticleBench(std::string name, GraphicType type)
+    : Bench(std::move(name)), graphicType(type) {
+}
+
 void ParticleBench::onDraw(tgfx::Canvas* canvas, const AppHost* host) {
   Init(host);
+  auto previousDrawCount = drawCount;
+  UpdateDrawCount(host);
+  onAnimate(host);
+  onDrawGraphics(canvas, host);
+  ValidateFrame(canvas, host);
+  auto previousFlushTime = lastFlushTime;
+  DrawStatus(canvas, host);
+  // Refreshing the status formats new strings, so only the frames in between count as steady.
+  if (drawCount == previousDrawCount && lastFlushTime == previousFlushTime &&
+      framesSinceInit > STEADY_WARM_UP_FRAMES) {
+    MemoryTracker::MarkSteadyFrame(this);
+  }
+}
+
+bool ParticleBench::isValidationWarmUp() const {
+  return FrameValidator::IsEnabled() && framesSinceInit <= FrameValidator::LastSampledFrame();
+}
+
+void ParticleBench::ValidateFrame(tgfx::Canvas* canvas, const AppHost* host) const {
+  if (!FrameValidator::IsEnabled() || !isDeterministic() ||
+      !FrameValidator::IsSampledFrame(framesSinceInit)) {
+    return;
+  }
+  auto key = name() + "@" + std::to_string(host->width()) + "x" + std::to_string(host->height());
+  if (!AntiAliasFlag) {
+    key += "-NoAA";
+  }
+  if (StrokeFlag) {
+    key += "-Stroke";
+  }
+  FrameValidator::Check(key + "#" + std::to_string(framesSinceInit), canvas);
+}
+
+void ParticleBench::onAnimate(const AppHost* host) {
   AnimateRects(host);
+}
+
+void ParticleBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
   DrawGraphics(canvas);
-  DrawStatus(canvas, host);
+}
+
+size_t ParticleBench::maxDrawCount() const {
+  return MaxDrawCount;
+}
+
+size_t ParticleBench::increaseStep() const {
+  return IncreaseStep;
 }
 
 static tgfx::Path CreateStar(const tgfx::Rect& rect) {
@@ -97,6 +152,8 @@ void ParticleBench::Init(const AppHost* host) {
   }
   width = hostWidth;
   height = hostHeight;
+  framesSinceInit = 0;
+  lastFlushTime = -1;
   status = {};
   drawCount = InitDrawCount;
   maxDrawCountReached = false;
@@ -117,12 +174,13 @@ void ParticleBench::Init(const AppHost* host) {
   }
 
   startRect = tgfx::Rect::MakeWH(20.f * host->density(), 20.f * host->density());
-  graphics.resize(MaxDrawCount);
+  auto maxCount = maxDrawCount();
+  graphics.resize(maxCount);
   std::mt19937 rectRng(18);
   std::mt19937 speedRng(36);
   std::uniform_real_distribution<float> rectDistribution(0, 1);
   std::uniform_real_distribution<float> speedDistribution(-1, 1);
-  for (size_t i = 0; i < MaxDrawCount; i++) {
+  for (size_t i = 0; i < maxCount; i++) {
     const auto size = (4.f + rectDistribution(rectRng) * 10.f) * host->density();
     auto& graphic = graphics[i];
     if (graphicType == GraphicType::Oval) {
@@ -134,14 +192,26 @@ void ParticleBench::Init(const AppHost* host) {
     graphic.speedY = speedDistribution(speedRng) * 5.0f;
   }
   if (graphicType == GraphicType::Star) {
-    paths.resize(MaxDrawCount);
-    for (size_t i = 0; i < MaxDrawCount; i++) {
+    paths.resize(maxCount);
+    for (size_t i = 0; i < maxCount; i++) {
       paths[i] = CreateStar(graphics[i].rect);
     }
   }
+  onInit(host);
 }
 
-void ParticleBench::AnimateRects(const AppHost* host) {
+void ParticleBench::UpdateDrawCount(const AppHost* host) {
+  framesSinceInit++;
+  if (isValidationWarmUp()) {
+    // Pins the particle count until the sampled frames are hashed, then ramps up from there.
+    drawCount = std::min(maxDrawCount(), VALIDATION_DRAW_COUNT);
+    return;
+  }
+  if (AppHost::IsDeterministic()) {
+    // A fixed schedule keeps the particle count independent of the measured frame times.
+    drawCount = std::min(drawCount + increaseStep(), maxDrawCount());
+    return;
+  }
   if (!maxDrawCountReached) {
     auto halfDrawInterval = static_cast<int64_t>(500000 / TargetFPS);
     auto drawTime = host->lastDrawTime();
@@ -149,17 +219,20 @@ void ParticleBench::AnimateRects(const AppHost* host) {
     if (idleTime > 0) {
       auto factor = static_cast<double>(idleTime > halfDrawInterval ? drawTime : idleTime) /
                     static_cast<double>(halfDrawInterval);
-      auto step = static_cast<int64_t>(IncreaseStep * factor);
+      auto step = static_cast<int64_t>(increaseStep() * factor);
       if (step < 1) {
         step = 1;
       }
-      drawCount = std::min(drawCount + static_cast<size_t>(step), MaxDrawCount);
+      drawCount = std::min(drawCount + static_cast<size_t>(step), maxDrawCount());
     }
   }
+}
+
+void ParticleBench::AnimateRects(const AppHost* host) {
   auto startX = host->mouseX();
   auto startY = host->mouseY();
   auto screenRect = tgfx::Rect::MakeWH(width, height);
-  if (!screenRect.contains(startX, startY)) {
+  if (!screenRect.contains(startX, startY) || isValidationWarmUp()) {
     startX = screenRect.centerX();
     startY = screenRect.centerY();
   }
@@ -186,7 +259,7 @@ void ParticleBench::DrawRects(tgfx::Canvas* canvas) const {
 }
 
 void ParticleBench::DrawStatus(tgfx::Canvas* canvas, const AppHost* host) {
-  auto currentTime = tgfx::Clock::Now();
+  auto currentTime = host->currentTime();
   if (lastFlushTime == -1) {
     lastFlushTime = currentTime;
   }
@@ -197,9 +270,9 @@ void ParticleBench::DrawStatus(tgfx::Canvas* canvas, const AppHost* host) {
       currentFPS = fps;
       auto drawTime = host->averageDrawTime();
       if (!maxDrawCountReached) {
-        if ((currentFPS < TargetFPS - 0.5f &&
+        if ((!AppHost::IsDeterministic() && currentFPS < TargetFPS - 0.5f &&
              drawTime > static_cast<int64_t>(1000000 / TargetFPS) - 2000) ||
-            drawCount >= MaxDrawCount) {
+            drawCount >= maxDrawCount()) {
           maxDrawCountReached = true;
         }
       }
@@ -217,6 +290,25 @@ void ParticleBench::DrawStatus(tgfx::Canvas* canvas, const AppHost* host) {
         countInfo = "[" + countInfo + "]";
       }
       status.push_back("Count: " + countInfo);
+      auto latency = host->averageLatency();
+      if (latency > 0) {
+        oss.str("");
+        oss << std::fixed << std::setprecision(1) << static_cast<float>(latency) / 1000.f;
+        status.push_back("Latency: " + oss.str());
+      }
+      if (host->gpuMemoryUsage() > 0) {
+        oss.str("");
+        oss << std::fixed << std::setprecision(1)
+            << static_cast<float>(host->gpuMemoryUsage()) / BYTES_PER_MB;
+        status.push_back("GPU: " + oss.str() + "MB");
+      }
+      if (MemoryTracker::IsEnabled()) {
+        AppendMemoryStatus();
+      }
+      onUpdateStatus(host, &status);
+      if (AppHost::IsDeterministic()) {
+        PrintStatus();
+      }
       if (currentFPS > 59.f) {
         fpsColor = tgfx::Color::Green();
       } else if (currentFPS > 29.f) {
@@ -230,24 +322,58 @@ void ParticleBench::DrawStatus(tgfx::Canvas* canvas, const AppHost* host) {
   perfData.fps = currentFPS;
   perfData.drawTime = static_cast<float>(host->averageDrawTime()) / 1000.f;
   perfData.drawCount = drawCount;
-  if (!DrawStatusFlag) {
+  // The measured values differ between runs, so the status bar is logged instead of drawn to keep
+  // the deterministic frames identical.
+  if (!DrawStatusFlag || AppHost::IsDeterministic()) {
     return;
   }
   canvas->resetMatrix();
+  auto statusWidth = STATUS_WIDTH * host->density();
+  auto rowHeight = FPS_BACKGROUND_HEIGHT * host->density();
+  auto columns = std::max(static_cast<size_t>(width / statusWidth), static_cast<size_t>(1));
+  auto rows = std::max((status.size() + columns - 1) / columns, static_cast<size_t>(1));
   tgfx::Paint paint = {};
   paint.setColor(tgfx::Color{0.32f, 0.42f, 0.62f, 0.9f});
-  auto backgroundRect =
-      tgfx::Rect::MakeWH(static_cast<float>(width), FPS_BACKGROUND_HEIGHT * host->density());
+  auto backgroundRect = tgfx::Rect::MakeWH(width, rowHeight * static_cast<float>(rows));
   canvas->drawRect(backgroundRect, paint);
-  auto top = FONT_SIZE * host->density();
   paint.setColor(fpsColor);
-  float left = STATUS_WIDTH * host->density() / 2;
-  for (auto& line : status) {
-    canvas->drawSimpleText(line, left, top, fpsFont, paint);
-    left += STATUS_WIDTH * host->density();
+  for (size_t i = 0; i < status.size(); i++) {
+    auto left = statusWidth / 2 + statusWidth * static_cast<float>(i % columns);
+    auto top = FONT_SIZE * host->density() + rowHeight * static_cast<float>(i / columns);
+    canvas->drawSimpleText(status[i], left, top, fpsFont, paint);
   }
 }
 
+void ParticleBench::AppendMemoryStatus() {
+  auto stats = MemoryTracker::Sample();
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(0);
+  for (size_t i = 0; i < FRAME_PHASE_COUNT; i++) {
+    oss << (i == 0 ? "" : "/") << stats.allocations[i];
+  }
+  status.push_back("Allocs: " + oss.str());
+  oss.str("");
+  oss << std::setprecision(1) << stats.allocatedBytes / 1024.f << "KB";
+  status.push_back("Alloc: " + oss.str());
+  oss.str("");
+  oss << static_cast<float>(stats.liveBytes) / BYTES_PER_MB << "MB";
+  status.push_back("Heap: " + oss.str());
+  oss.str("");
+  oss << static_cast<float>(stats.residentBytes) / BYTES_PER_MB << "MB";
+  status.push_back("RSS: " + oss.str());
+  oss.str("");
+  oss << static_cast<float>(stats.peakResidentBytes) / BYTES_PER_MB << "MB";
+  status.push_back("Peak: " + oss.str());
+}
+
+void ParticleBench::PrintStatus() const {
+  std::string line = name();
+  for (auto& item : status) {
+    line += ", " + item;
+  }
+  tgfx::PrintLog("%s", line.c_str());
+}
+
 void ParticleBench::DrawCircle(tgfx::Canvas* canvas) const {
   for (size_t i = 0; i < drawCount; i++) {
     auto& graphic = graphics[i];
@@ -341,6 +467,10 @@ PerfData ParticleBench::getPerfData() const {
   return perfData;
 }
 
+size_t ParticleBench::currentDrawCount() const {
+  return perfData.drawCount;
+}
+
 void ParticleBench::SetAntiAlias(bool aa) {
   AntiAliasFlag = aa;
 }
@@ -348,4 +478,8 @@ void ParticleBench::SetAntiAlias(bool aa) {
 void ParticleBench::SetStroke(bool stroke) {
   StrokeFlag = stroke;
 }
+
+void ParticleBench::SetLineJoin(tgfx::LineJoin join) {
+  LineJoinType = join;
+}
 }  // namespace benchmark
\ No newline at end of file
@@ -64,22 +64,97 @@ class ParticleBench : public Bench {
 
   static void SetStroke(bool stroke);
 
+  static void SetLineJoin(tgfx::LineJoin join);
+
   bool isMaxDrawCountReached() const;
 
   PerfData getPerfData() const;
 
+  size_t currentDrawCount() const override;
+
  protected:
+  /**
+   * Creates a ParticleBench subclass with the given name. The graphic type decides the shape and
+   * size of the particles.
+   */
+  ParticleBench(std::string name, GraphicType type);
+
   void onDraw(tgfx::Canvas* canvas, const AppHost* host) override;
 
+  /**
+   * Called after the particles are reset, which happens on the first frame and whenever the screen
+   * size changes. Subclasses can override this method to build their own per-particle data.
+   */
+  virtual void onInit(const AppHost*) {
+  }
+
+  /**
+   * Moves the first drawCount particles. The default implementation moves them at constant speed
+   * and respawns those leaving the screen at the mouse position.
+   */
+  virtual void onAnimate(const AppHost* host);
+
+  /**
+   * Draws the first drawCount particles. The default implementation draws them as the graphic type
+   * of this bench.
+   */
+  virtual void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host);
+
+  /**
+   * Appends extra lines to the status bar. Called each time the FPS, Time and Count lines are
+   * refreshed.
+   */
+  virtual void onUpdateStatus(const AppHost*, std::vector<std::string>*) {
+  }
+
+  /**
+   * Returns the maximum number of particles. Subclasses drawing expensive particles can override
+   * this method to lower the limit set by SetMaxDrawCount().
+   */
+  virtual size_t maxDrawCount() const;
+
+  /**
+   * Returns true if the frames of this bench depend only on the frame index after a reset, so that
+   * FrameValidator can hash them. Subclasses driven by wall-clock time or worker threads override
+   * this method to return false.
+   */
+  virtual bool isDeterministic() const {
+    return true;
+  }
+
+  /**
+   * Returns the largest number of particles added per frame while ramping up. Subclasses drawing
+   * expensive particles can override this method to ramp up more slowly.
+   */
+  virtual size_t increaseStep() const;
+
+  float width = 0;   //appHost width
+  float height = 0;  //appHost height
+  size_t drawCount = 1;
+  std::vector<GraphicData> graphics = {};
+  tgfx::Rect startRect = tgfx::Rect::MakeEmpty();
+  tgfx::Paint paints[3];  // red, green, blue solid paints
+  GraphicType graphicType = GraphicType::Rect;
+
  private:
   void Init(const AppHost* host);
 
+  void UpdateDrawCount(const AppHost* host);
+
+  bool isValidationWarmUp() const;
+
+  void ValidateFrame(tgfx::Canvas* canvas, const AppHost* host) const;
+
   void AnimateRects(const AppHost* host);
 
   void DrawRects(tgfx::Canvas* canvas) const;
 
   void DrawStatus(tgfx::Canvas* canvas, const AppHost* host);
 
+  void AppendMemoryStatus();
+
+  void PrintStatus() const;
+
   void DrawCircle(tgfx::Canvas* canvas) const;
 
   void DrawRRect(tgfx::Canvas* canvas) const;
@@ -91,19 +166,13 @@ class ParticleBench : public Bench {
   void DrawGraphics(tgfx::Canvas* canvas) const;
 
  private:
-  float width = 0;   //appHost width
-  float height = 0;  //appHost height
-  size_t drawCount = 1;
   float currentFPS = 0.f;
-  std::vector<GraphicData> graphics = {};
+  int64_t framesSinceInit = 0;
   std::vector<tgfx::Path> paths = {};
-  tgfx::Rect startRect = tgfx::Rect::MakeEmpty();
-  tgfx::Paint paints[3];  // red, green, blue solid paints
   int64_t lastFlushTime = -1;
   tgfx::Font fpsFont = {};
   tgfx::Color fpsColor = tgfx::Color::Green();
   std::vector<std::string> status = {};
-  GraphicType graphicType = GraphicType::Rect;
   bool maxDrawCountReached = false;
   PerfData perfData = {};
 };
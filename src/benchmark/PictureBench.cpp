@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PictureBench.h"
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/PictureRecorder.h"
+
+namespace benchmark {
+static constexpr size_t CHUNK_SIZE = 1000;
+static constexpr float ROTATE_SPEED = 0.2f;
+
+static float DirtyFraction = 0.1f;
+
+static std::string ToString(PictureMode mode) {
+  switch (mode) {
+    case PictureMode::Immediate:
+      return "Immediate";
+    case PictureMode::Replay:
+      return "Replay";
+    case PictureMode::Partial:
+      return "Partial";
+    default:
+      return "Unknown";
+  }
+}
+
+PictureBench::PictureBench(PictureMode mode)
+    : ParticleBench("PictureBench-" + ToString(mode), GraphicType::Rect), pictureMode(mode) {
+}
+
+void PictureBench::SetDirtyFraction(float fraction) {
+  DirtyFraction = std::max(0.f, std::min(fraction, 1.f));
+}
+
+void PictureBench::onInit(const AppHost*) {
+  // Scatter the particles over the screen, since they no longer fly out from the start point.
+  auto maxCount = maxDrawCount();
+  for (size_t i = 0; i < maxCount; i++) {
+    auto& rect = graphics[i].rect;
+    auto x = (graphics[i].speedX / 10.f + 0.5f) * width;
+    auto y = (graphics[i].speedY / 10.f + 0.5f) * height;
+    rect.offsetTo(x - rect.width() * 0.5f, y - rect.height() * 0.5f);
+  }
+  frameIndex = 0;
+  pictures.clear();
+  recordedCounts.clear();
+  dirtyChunks.clear();
+  recordTime = 0;
+}
+
+void PictureBench::onAnimate(const AppHost*) {
+  frameIndex++;
+  auto degrees = std::fmod(static_cast<float>(frameIndex) * ROTATE_SPEED, 360.f);
+  auto scale = 1.f + 0.05f * std::sin(static_cast<float>(frameIndex) * 0.02f);
+  sceneMatrix = tgfx::Matrix::MakeTrans(-width * 0.5f, -height * 0.5f);
+  sceneMatrix.postScale(scale, scale);
+  sceneMatrix.postRotate(degrees);
+  sceneMatrix.postTranslate(width * 0.5f, height * 0.5f);
+
+  auto chunkCount = (drawCount + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  dirtyChunks.assign(chunkCount, false);
+  if (pictureMode == PictureMode::Replay) {
+    return;
+  }
+  // Move a different window of chunks every frame, wrapping around the scene.
+  auto dirtyCount = static_cast<size_t>(std::ceil(static_cast<float>(chunkCount) * DirtyFraction));
+  auto firstChunk = static_cast<size_t>(frameIndex) * dirtyCount;
+  for (size_t j = 0; j < dirtyCount; j++) {
+    auto chunkIndex = (firstChunk + j) % chunkCount;
+    dirtyChunks[chunkIndex] = true;
+    auto end = std::min((chunkIndex + 1) * CHUNK_SIZE, drawCount);
+    for (size_t i = chunkIndex * CHUNK_SIZE; i < end; i++) {
+      auto& graphic = graphics[i];
+      auto& rect = graphic.rect;
+      rect.offset(graphic.speedX, graphic.speedY);
+      if (rect.right <= 0 || rect.left >= width) {
+        graphic.speedX = -graphic.speedX;
+      }
+      if (rect.bottom <= 0 || rect.top >= height) {
+        graphic.speedY = -graphic.speedY;
+      }
+    }
+  }
+}
+
+void PictureBench::recordChunk(size_t chunkIndex) {
+  auto begin = chunkIndex * CHUNK_SIZE;
+  auto end = std::min(begin + CHUNK_SIZE, drawCount);
+  tgfx::PictureRecorder recorder = {};
+  auto canvas = recorder.beginRecording();
+  for (size_t i = begin; i < end; i++) {
+    canvas->drawRect(graphics[i].rect, paints[i % 3]);
+  }
+  pictures[chunkIndex] = recorder.finishRecordingAsPicture();
+  recordedCounts[chunkIndex] = end - begin;
+}
+
+void PictureBench::updatePictures() {
+  auto startTime = tgfx::Clock::Now();
+  auto chunkCount = (drawCount + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  pictures.resize(chunkCount);
+  recordedCounts.resize(chunkCount, 0);
+  for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+    auto count = std::min(CHUNK_SIZE, drawCount - chunkIndex * CHUNK_SIZE);
+    // Record the chunks added by the draw count ramp, and re-record those that have changed.
+    if (recordedCounts[chunkIndex] != count || dirtyChunks[chunkIndex]) {
+      recordChunk(chunkIndex);
+    }
+  }
+  recordTime = tgfx::Clock::Now() - startTime;
+}
+
+void PictureBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  if (pictureMode == PictureMode::Immediate) {
+    canvas->concat(sceneMatrix);
+    for (size_t i = 0; i < drawCount; i++) {
+      canvas->drawRect(graphics[i].rect, paints[i % 3]);
+    }
+    canvas->resetMatrix();
+  } else {
+    updatePictures();
+    for (auto& picture : pictures) {
+      canvas->drawPicture(picture, &sceneMatrix, nullptr);
+    }
+  }
+}
+
+void PictureBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  if (pictureMode == PictureMode::Immediate) {
+    return;
+  }
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1) << static_cast<float>(recordTime) / 1000.f;
+  lines->push_back("Record: " + oss.str());
+  lines->push_back("Pictures: " + std::to_string(pictures.size()));
+}
+}  // namespace benchmark
@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+#include "tgfx/core/Picture.h"
+
+namespace benchmark {
+
+enum class PictureMode { Immediate, Replay, Partial };
+
+/**
+ * PictureBench draws a scene of still particles under a transform that changes every frame. The
+ * Immediate mode issues every draw call each frame, the Replay mode records the particles into
+ * pictures once and replays them, and the Partial mode re-records only the pictures whose particles
+ * have moved.
+ */
+class PictureBench : public ParticleBench {
+ public:
+  explicit PictureBench(PictureMode mode);
+
+  /**
+   * Sets the fraction of particles that move every frame in the Immediate and Partial modes, in the
+   * range [0, 1]. The default value is 0.1.
+   */
+  static void SetDirtyFraction(float fraction);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+ private:
+  void recordChunk(size_t chunkIndex);
+
+  void updatePictures();
+
+  PictureMode pictureMode = PictureMode::Immediate;
+  tgfx::Matrix sceneMatrix = {};
+  int64_t frameIndex = 0;
+  // The particles are recorded in chunks of a fixed size, one picture per chunk.
+  std::vector<std::shared_ptr<tgfx::Picture>> pictures = {};
+  std::vector<size_t> recordedCounts = {};
+  std::vector<bool> dirtyChunks = {};
+  int64_t recordTime = 0;
+};
+
+}  // namespace benchmark
@@ -0,0 +1,312 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PosterBench.h"
+#include <cstring>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Surface.h"
+#include "tgfx/gpu/opengl/GLDevice.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+static constexpr int TILE_SIZE = 1024;
+static constexpr int MAX_PREVIEW_SIZE = 1024;
+static constexpr size_t ITEMS_PER_TILE = 400;
+static constexpr size_t IMAGE_INTERVAL = 20;
+static constexpr size_t MAX_THREAD_COUNT = 8;
+static constexpr int64_t IDLE_TIMEOUT = 500000;
+
+static int PosterSize = 16384;
+
+PosterBench::PosterBench() : ParticleBench("PosterBench", GraphicType::Rect) {
+}
+
+PosterBench::~PosterBench() {
+  stopWorkers();
+}
+
+void PosterBench::SetPosterSize(int size) {
+  auto tiles = std::max((size + TILE_SIZE - 1) / TILE_SIZE, 1);
+  PosterSize = tiles * TILE_SIZE;
+}
+
+size_t PosterBench::maxDrawCount() const {
+  return 1;
+}
+
+void PosterBench::onInit(const AppHost* host) {
+  stopWorkers();
+  drawCount = maxDrawCount();
+  posterSize = PosterSize;
+  tileColumns = posterSize / TILE_SIZE;
+  // The preview takes one pixel out of every previewScale, so each tile maps to a whole block.
+  previewScale = (posterSize + MAX_PREVIEW_SIZE - 1) / MAX_PREVIEW_SIZE;
+  previewSize = tileColumns * (TILE_SIZE / previewScale);
+  previewPixels.assign(static_cast<size_t>(previewSize * previewSize * 4), 0);
+  previewImage = nullptr;
+  imageCache.clear();
+  imageCache.addSource("bridge", host->getImage("bridge"));
+
+  auto tileCount = static_cast<size_t>(tileColumns * tileColumns);
+  auto posterRect = tgfx::Rect::MakeWH(posterSize, posterSize);
+  items.resize(tileCount * ITEMS_PER_TILE);
+  grid.reset(posterRect, TILE_SIZE * 0.5f);
+  maxHalfSize = 0;
+  std::mt19937 itemRng(42);
+  std::uniform_real_distribution<float> distribution(0, 1);
+  for (size_t i = 0; i < items.size(); i++) {
+    auto& item = items[i];
+    item.isImage = i % IMAGE_INTERVAL == 0;
+    auto size = item.isImage ? 64.f + distribution(itemRng) * 192.f
+                             : 8.f + distribution(itemRng) * 40.f;
+    auto x = distribution(itemRng) * (posterRect.width() - size);
+    auto y = distribution(itemRng) * (posterRect.height() - size);
+    item.rect.setXYWH(x, y, size, size);
+    item.type = static_cast<GraphicType>(i % 4);
+    maxHalfSize = std::max(maxHalfSize, size * 0.5f);
+    grid.insert(static_cast<uint32_t>(i), item.rect);
+  }
+
+  results.clear();
+  for (size_t threadCount = 1; threadCount < MAX_THREAD_COUNT; threadCount *= 2) {
+    results.push_back({threadCount, 0, 0, false});
+  }
+  results.push_back({MAX_THREAD_COUNT, 0, 0, false});
+  stepIndex = 0;
+}
+
+void PosterBench::onAnimate(const AppHost*) {
+  auto currentTime = tgfx::Clock::Now();
+  if (currentTime - lastActiveTime > IDLE_TIMEOUT) {
+    // The workers have been idle, restart the current step to keep its result accurate.
+    stopWorkers();
+  }
+  lastActiveTime = currentTime;
+  if (workers.empty()) {
+    startWorkers(results[stepIndex].threadCount);
+    return;
+  }
+  auto& result = results[stepIndex];
+  if (finishedTiles < tileColumns * tileColumns) {
+    if (runningWorkers > 0) {
+      return;
+    }
+    // Every worker has exited on an error, so the missing tiles will never be rendered.
+    tgfx::PrintError("PosterBench::onAnimate() the workers stopped after %d of %d tiles!",
+                     finishedTiles.load(), tileColumns * tileColumns);
+    stopWorkers();
+    result.failed = true;
+    stepIndex = (stepIndex + 1) % results.size();
+    startWorkers(results[stepIndex].threadCount);
+    return;
+  }
+  auto elapsedTime = currentTime - stepStartTime;
+  stopWorkers();
+  result.failed = false;
+  result.tilesPerSecond = static_cast<float>(tileColumns * tileColumns) * 1000000.f /
+                          static_cast<float>(elapsedTime);
+  result.peakMemory = 0;
+  for (auto memory : workerPeakMemory) {
+    result.peakMemory += memory;
+  }
+  auto info = tgfx::ImageInfo::Make(previewSize, previewSize, tgfx::ColorType::RGBA_8888);
+  auto pixels = tgfx::Data::MakeWithCopy(previewPixels.data(), previewPixels.size());
+  previewImage = tgfx::Image::MakeFrom(info, std::move(pixels));
+  stepIndex = (stepIndex + 1) % results.size();
+  startWorkers(results[stepIndex].threadCount);
+}
+
+void PosterBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  if (previewImage == nullptr) {
+    return;
+  }
+  auto side = std::min(width, height);
+  auto rect = tgfx::Rect::MakeXYWH((width - side) * 0.5f, (height - side) * 0.5f, side, side);
+  canvas->drawImageRect(previewImage, rect, tgfx::SamplingOptions(tgfx::FilterMode::Linear));
+}
+
+void PosterBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  std::ostringstream oss;
+  auto tileCount = tileColumns * tileColumns;
+  lines->push_back("Poster: " + std::to_string(posterSize));
+  lines->push_back("Threads: " + std::to_string(results[stepIndex].threadCount));
+  lines->push_back("Tiles: " + std::to_string(finishedTiles.load()) + "/" +
+                   std::to_string(tileCount));
+  // The images are decoded once per step, every other request reuses the decoded image.
+  lines->push_back("Decodes: " + std::to_string(imageCache.missCount()) + "/" +
+                   std::to_string(imageCache.missCount() + imageCache.hitCount()));
+  auto baseRate = results.front().tilesPerSecond;
+  for (auto& result : results) {
+    if (result.failed) {
+      lines->push_back("K" + std::to_string(result.threadCount) + ": failed");
+      continue;
+    }
+    if (result.tilesPerSecond <= 0) {
+      continue;
+    }
+    auto efficiency =
+        baseRate > 0 ? result.tilesPerSecond / (baseRate * static_cast<float>(result.threadCount))
+                     : 0.f;
+    oss.str("");
+    oss << "K" << result.threadCount << ": " << std::fixed << std::setprecision(1)
+        << result.tilesPerSecond << "/s " << std::setprecision(0) << efficiency * 100.f << "% "
+        << static_cast<double>(result.peakMemory) / 1048576.0 << "MB";
+    lines->push_back(oss.str());
+  }
+}
+
+void PosterBench::startWorkers(size_t threadCount) {
+  exiting = false;
+  nextTile = 0;
+  finishedTiles = 0;
+  imageCache.clear();
+  workerPeakMemory.assign(threadCount, 0);
+  runningWorkers = threadCount;
+  stepStartTime = tgfx::Clock::Now();
+  for (size_t i = 0; i < threadCount; i++) {
+    workers.emplace_back(&PosterBench::workerLoop, this, i);
+  }
+}
+
+void PosterBench::stopWorkers() {
+  exiting = true;
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  workers.clear();
+}
+
+void PosterBench::renderTile(tgfx::Canvas* canvas, int tileIndex, const tgfx::Paint itemPaints[],
+                             std::vector<uint32_t>* itemIDs) {
+  auto tileLeft = static_cast<float>(tileIndex % tileColumns * TILE_SIZE);
+  auto tileTop = static_cast<float>(tileIndex / tileColumns * TILE_SIZE);
+  auto tileExtent = static_cast<float>(TILE_SIZE);
+  auto tileRect = tgfx::Rect::MakeXYWH(tileLeft, tileTop, tileExtent, tileExtent);
+  canvas->clear(tgfx::Color::White());
+  canvas->setMatrix(tgfx::Matrix::MakeTrans(-tileLeft, -tileTop));
+  itemIDs->clear();
+  grid.query(tileRect, maxHalfSize, itemIDs);
+  for (auto id : *itemIDs) {
+    auto& item = items[id];
+    if (!item.rect.intersects(tileRect)) {
+      continue;
+    }
+    auto& paint = itemPaints[id % 3];
+    if (item.isImage) {
+      auto image = imageCache.get("bridge");
+      if (image != nullptr) {
+        canvas->drawImageRect(image, item.rect);
+      }
+      continue;
+    }
+    switch (item.type) {
+      case GraphicType::Circle:
+        canvas->drawCircle(item.rect.centerX(), item.rect.centerY(), item.rect.width() * 0.5f,
+                           paint);
+        break;
+      case GraphicType::Oval:
+        canvas->drawOval(item.rect, paint);
+        break;
+      case GraphicType::RRect:
+        canvas->drawRoundRect(item.rect, item.rect.width() * 0.2f, item.rect.width() * 0.2f,
+                              paint);
+        break;
+      default:
+        canvas->drawRect(item.rect, paint);
+        break;
+    }
+  }
+  canvas->resetMatrix();
+}
+
+void PosterBench::stitchTile(int tileIndex, const uint8_t* pixels) {
+  // Each tile owns a disjoint block of the preview, so workers can write it without locking.
+  auto blockSize = TILE_SIZE / previewScale;
+  auto blockLeft = tileIndex % tileColumns * blockSize;
+  auto blockTop = tileIndex / tileColumns * blockSize;
+  for (int y = 0; y < blockSize; y++) {
+    auto srcRow = pixels + static_cast<size_t>(y * previewScale * TILE_SIZE * 4);
+    auto dstRow = previewPixels.data() + static_cast<size_t>(((blockTop + y) * previewSize +
+                                                              blockLeft) * 4);
+    for (int x = 0; x < blockSize; x++) {
+      memcpy(dstRow + x * 4, srcRow + x * previewScale * 4, 4);
+    }
+  }
+}
+
+void PosterBench::workerLoop(size_t index) {
+  auto device = tgfx::GLDevice::Make();
+  if (device == nullptr) {
+    tgfx::PrintError("PosterBench::workerLoop() failed to create the device!");
+    runningWorkers--;
+    return;
+  }
+  auto tileCount = tileColumns * tileColumns;
+  auto info = tgfx::ImageInfo::Make(TILE_SIZE, TILE_SIZE, tgfx::ColorType::RGBA_8888);
+  std::vector<uint8_t> tilePixels(info.byteSize());
+  std::vector<uint32_t> itemIDs = {};
+  tgfx::Paint itemPaints[3];
+  for (int i = 0; i < 3; i++) {
+    tgfx::Color color = tgfx::Color::Black();
+    color[i] = 1.f;
+    itemPaints[i].setColor(color);
+  }
+  std::shared_ptr<tgfx::Surface> surface = nullptr;
+  while (!exiting) {
+    if (tgfx::Clock::Now() - lastActiveTime > IDLE_TIMEOUT) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      continue;
+    }
+    auto tileIndex = nextTile++;
+    if (tileIndex >= tileCount) {
+      break;
+    }
+    auto context = device->lockContext();
+    if (context == nullptr) {
+      tgfx::PrintError("PosterBench::workerLoop() failed to lock the context!");
+      break;
+    }
+    if (surface == nullptr) {
+      surface = tgfx::Surface::Make(context, TILE_SIZE, TILE_SIZE);
+    }
+    if (surface == nullptr) {
+      device->unlock();
+      tgfx::PrintError("PosterBench::workerLoop() failed to create the surface!");
+      break;
+    }
+    renderTile(surface->getCanvas(), tileIndex, itemPaints, &itemIDs);
+    auto readSucceeded = surface->readPixels(info, tilePixels.data());
+    workerPeakMemory[index] = std::max(workerPeakMemory[index], context->memoryUsage());
+    device->unlock();
+    if (!readSucceeded) {
+      tgfx::PrintError("PosterBench::workerLoop() failed to read the tile pixels!");
+      break;
+    }
+    stitchTile(tileIndex, tilePixels.data());
+    finishedTiles++;
+  }
+  if (surface != nullptr && device->lockContext() != nullptr) {
+    surface = nullptr;
+    device->unlock();
+  }
+  runningWorkers--;
+}
+}  // namespace benchmark
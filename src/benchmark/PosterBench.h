@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include "DecodedImageCache.h"
+#include "ParticleBench.h"
+#include "SpatialGrid.h"
+
+namespace benchmark {
+
+/**
+ * PosterBench renders a poster far larger than any surface, made of particles and images, by
+ * splitting it into tiles. Worker threads each own an offscreen device, take tiles from a shared
+ * counter, read every finished tile back and stitch it into a downscaled preview shown in the
+ * window. The images are decoded once in a cache shared by all workers. The thread count steps
+ * through 1, 2, 4 and 8, rendering the whole poster at each step, and the status bar reports tiles
+ * per second, scaling efficiency and the peak GPU memory of all workers for each, along with the
+ * image decodes out of all image requests in the current step. The peak memory is the sum of the
+ * resource usage of the worker contexts, so it excludes the memory taken by creating the devices
+ * and the resident size of the process. A step whose workers stop before rendering every tile is
+ * reported as failed. Only available on native platforms.
+ */
+class PosterBench : public ParticleBench {
+ public:
+  PosterBench();
+
+  ~PosterBench() override;
+
+  /**
+   * Sets the width and height of the poster in pixels, rounded up to whole tiles. The default
+   * value is 16384.
+   */
+  static void SetPosterSize(int size);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+  bool isDeterministic() const override {
+    return false;
+  }
+
+ private:
+  struct PosterItem {
+    tgfx::Rect rect = tgfx::Rect::MakeEmpty();
+    GraphicType type = GraphicType::Rect;
+    bool isImage = false;
+  };
+
+  struct StepResult {
+    size_t threadCount = 0;
+    float tilesPerSecond = 0;
+    size_t peakMemory = 0;
+    bool failed = false;
+  };
+
+  void startWorkers(size_t threadCount);
+
+  void stopWorkers();
+
+  void workerLoop(size_t index);
+
+  void renderTile(tgfx::Canvas* canvas, int tileIndex, const tgfx::Paint itemPaints[],
+                  std::vector<uint32_t>* itemIDs);
+
+  void stitchTile(int tileIndex, const uint8_t* pixels);
+
+  int posterSize = 0;
+  int tileColumns = 0;
+  int previewScale = 1;
+  int previewSize = 0;
+  std::vector<PosterItem> items = {};
+  SpatialGrid grid = {};
+  float maxHalfSize = 0;
+  DecodedImageCache imageCache = {};
+  std::vector<uint8_t> previewPixels = {};
+  std::shared_ptr<tgfx::Image> previewImage = nullptr;
+  std::vector<std::thread> workers = {};
+  std::vector<size_t> workerPeakMemory = {};
+  std::atomic<bool> exiting = {false};
+  std::atomic<int64_t> lastActiveTime = {0};
+  std::atomic<int> nextTile = {0};
+  std::atomic<int> finishedTiles = {0};
+  std::atomic<size_t> runningWorkers = {0};
+  std::vector<StepResult> results = {};
+  size_t stepIndex = 0;
+  int64_t stepStartTime = 0;
+};
+
+}  // namespace benchmark
@@ -0,0 +1,192 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ReadbackBench.h"
+#include <iomanip>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Surface.h"
+
+namespace benchmark {
+static constexpr size_t SCENE_PARTICLES = 2000;
+static constexpr int SURFACE_SIZES[] = {512, 1024, 2048};
+static constexpr tgfx::ColorType READ_FORMATS[] = {
+    tgfx::ColorType::RGBA_8888, tgfx::ColorType::BGRA_8888, tgfx::ColorType::ALPHA_8};
+static constexpr int64_t STEP_DURATION = 2000000;
+
+static std::string ToString(ReadbackMode mode) {
+  switch (mode) {
+    case ReadbackMode::Sync:
+      return "Sync";
+    case ReadbackMode::DoubleBuffered:
+      return "DoubleBuffered";
+    default:
+      return "Unknown";
+  }
+}
+
+static std::string ToString(tgfx::ColorType colorType) {
+  switch (colorType) {
+    case tgfx::ColorType::RGBA_8888:
+      return "RGBA";
+    case tgfx::ColorType::BGRA_8888:
+      return "BGRA";
+    case tgfx::ColorType::ALPHA_8:
+      return "A8";
+    default:
+      return "Unknown";
+  }
+}
+
+ReadbackBench::ReadbackBench(ReadbackMode mode)
+    : ParticleBench("ReadbackBench-" + ToString(mode), GraphicType::Rect), readbackMode(mode) {
+}
+
+size_t ReadbackBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), SCENE_PARTICLES);
+}
+
+void ReadbackBench::onInit(const AppHost*) {
+  // The scene is fixed, so that only the surface size and pixel format change between steps.
+  drawCount = maxDrawCount();
+  results.clear();
+  for (auto size : SURFACE_SIZES) {
+    for (auto colorType : READ_FORMATS) {
+      results.push_back({size, colorType, 0, 0});
+    }
+  }
+  stepIndex = 0;
+  stepChanged = true;
+}
+
+void ReadbackBench::onAnimate(const AppHost* host) {
+  ParticleBench::onAnimate(host);
+  if (stepChanged) {
+    return;
+  }
+  auto currentTime = tgfx::Clock::Now();
+  auto& result = results[stepIndex];
+  if (readTime > 0) {
+    result.megabytesPerSecond = static_cast<float>(static_cast<double>(readBytes) / 1048576.0 /
+                                                   (static_cast<double>(readTime) / 1000000.0));
+  }
+  if (readCount > 0) {
+    result.latency = static_cast<float>(latencyTime / readCount) / 1000.f;
+  }
+  if (currentTime - stepStartTime >= STEP_DURATION) {
+    stepIndex = (stepIndex + 1) % results.size();
+    stepChanged = true;
+  }
+}
+
+void ReadbackBench::resetStep(tgfx::Context* context) {
+  auto& result = results[stepIndex];
+  for (auto& surface : surfaces) {
+    surface = tgfx::Surface::Make(context, result.size, result.size);
+  }
+  auto info = tgfx::ImageInfo::Make(result.size, result.size, result.colorType);
+  pixels.resize(info.byteSize());
+  frameIndex = 0;
+  readBytes = 0;
+  readTime = 0;
+  latencyTime = 0;
+  readCount = 0;
+  stepStartTime = tgfx::Clock::Now();
+  stepChanged = false;
+}
+
+void ReadbackBench::renderScene(tgfx::Surface* surface, const AppHost* host) {
+  auto canvas = surface->getCanvas();
+  canvas->clear(tgfx::Color::White());
+  canvas->save();
+  canvas->scale(static_cast<float>(surface->width()) / width,
+                static_cast<float>(surface->height()) / height);
+  ParticleBench::onDrawGraphics(canvas, host);
+  canvas->restore();
+}
+
+bool ReadbackBench::readSurface(tgfx::Surface* surface, int64_t submitTime) {
+  auto& result = results[stepIndex];
+  auto info = tgfx::ImageInfo::Make(result.size, result.size, result.colorType);
+  auto startTime = tgfx::Clock::Now();
+  if (!surface->readPixels(info, pixels.data())) {
+    return false;
+  }
+  auto endTime = tgfx::Clock::Now();
+  readTime += endTime - startTime;
+  readBytes += info.byteSize();
+  readCount++;
+  latencyTime += endTime - submitTime;
+  return true;
+}
+
+void ReadbackBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) {
+  auto windowSurface = canvas->getSurface();
+  if (windowSurface == nullptr || windowSurface->getContext() == nullptr) {
+    return;
+  }
+  auto context = windowSurface->getContext();
+  if (stepChanged) {
+    resetStep(context);
+  }
+  auto current = readbackMode == ReadbackMode::Sync ? 0 : frameIndex % 2;
+  auto surface = surfaces[current];
+  if (surface == nullptr) {
+    return;
+  }
+  renderScene(surface.get(), host);
+  // Both modes submit the frame before reading, so the latency starts from the same point.
+  context->flushAndSubmit();
+  submitTimes[current] = tgfx::Clock::Now();
+  if (readbackMode == ReadbackMode::Sync) {
+    readSurface(surface.get(), submitTimes[current]);
+  } else if (frameIndex > 0) {
+    auto previous = (frameIndex + 1) % 2;
+    readSurface(surfaces[previous].get(), submitTimes[previous]);
+  }
+  frameIndex++;
+
+  // Draws the throughput of each step as a bar chart.
+  float maxSpeed = 1.f;
+  for (auto& result : results) {
+    maxSpeed = std::max(maxSpeed, result.megabytesPerSecond);
+  }
+  auto barWidth = width / static_cast<float>(results.size() * 2 + 1);
+  auto maxBarHeight = height * 0.6f;
+  for (size_t i = 0; i < results.size(); i++) {
+    auto barHeight = maxBarHeight * results[i].megabytesPerSecond / maxSpeed;
+    auto left = barWidth * static_cast<float>(i * 2 + 1);
+    auto rect = tgfx::Rect::MakeLTRB(left, height - barHeight, left + barWidth, height);
+    canvas->drawRect(rect, paints[i == stepIndex ? 1 : 2]);
+  }
+}
+
+void ReadbackBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  std::ostringstream oss;
+  auto& current = results[stepIndex];
+  lines->push_back("Size: " + std::to_string(current.size) + " " + ToString(current.colorType));
+  oss << std::fixed << std::setprecision(1) << current.latency;
+  lines->push_back("Latency: " + oss.str());
+  for (auto& result : results) {
+    oss.str("");
+    oss << result.size << " " << ToString(result.colorType) << ": " << std::fixed
+        << std::setprecision(0) << result.megabytesPerSecond << "MB/s";
+    lines->push_back(oss.str());
+  }
+}
+}  // namespace benchmark
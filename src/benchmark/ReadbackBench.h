@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+enum class ReadbackMode { Sync, DoubleBuffered };
+
+/**
+ * ReadbackBench renders the particles into an offscreen surface every frame and reads the pixels
+ * back. The Sync mode reads each frame right after submitting it. The DoubleBuffered mode renders
+ * into two surfaces in turn and reads the one submitted in the previous frame. Both modes read
+ * with a blocking readPixels() call, so the DoubleBuffered mode only shows how much of the wait is
+ * hidden when the read is issued one frame later. The bench steps through several surface sizes
+ * and pixel formats, a few seconds each, and reports the readback throughput of every step and
+ * the latency from submitting a frame to having its pixels, measured the same way in both modes.
+ */
+class ReadbackBench : public ParticleBench {
+ public:
+  explicit ReadbackBench(ReadbackMode mode);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+  bool isDeterministic() const override {
+    return false;
+  }
+
+ private:
+  struct StepResult {
+    int size = 0;
+    tgfx::ColorType colorType = tgfx::ColorType::RGBA_8888;
+    float megabytesPerSecond = 0;
+    float latency = 0;
+  };
+
+  void resetStep(tgfx::Context* context);
+
+  void renderScene(tgfx::Surface* surface, const AppHost* host);
+
+  bool readSurface(tgfx::Surface* surface, int64_t submitTime);
+
+  ReadbackMode readbackMode = ReadbackMode::Sync;
+  std::vector<StepResult> results = {};
+  size_t stepIndex = 0;
+  bool stepChanged = true;
+  int64_t stepStartTime = 0;
+  std::shared_ptr<tgfx::Surface> surfaces[2] = {};
+  int64_t submitTimes[2] = {};
+  int64_t frameIndex = 0;
+  std::vector<uint8_t> pixels = {};
+  size_t readBytes = 0;
+  int64_t readTime = 0;
+  int64_t latencyTime = 0;
+  int64_t readCount = 0;
+};
+
+}  // namespace benchmark
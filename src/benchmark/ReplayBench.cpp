@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ReplayBench.h"
+#include <iomanip>
+#include <sstream>
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+static std::string CapturePath = "";
+static size_t ReplayFrameCount = 0;
+
+ReplayBench::ReplayBench() : ParticleBench("ReplayBench", GraphicType::Rect) {
+}
+
+void ReplayBench::SetCapturePath(const std::string& path) {
+  CapturePath = path;
+}
+
+void ReplayBench::SetReplayFrameCount(size_t count) {
+  ReplayFrameCount = count;
+}
+
+size_t ReplayBench::maxDrawCount() const {
+  return 1;
+}
+
+size_t ReplayBench::runLength() const {
+  return ReplayFrameCount > 0 ? ReplayFrameCount : reader.frameCount();
+}
+
+void ReplayBench::onInit(const AppHost*) {
+  drawCount = maxDrawCount();
+  if (loadedPath != CapturePath) {
+    loadedPath = CapturePath;
+    if (CapturePath.empty() || !reader.open(CapturePath)) {
+      reader.close();
+    }
+  }
+  frameIndex = 0;
+  commandCount = 0;
+  runTime = 0;
+  runFrames = 0;
+  lastRunAverage = 0;
+}
+
+void ReplayBench::onAnimate(const AppHost* host) {
+  if (reader.frameCount() == 0) {
+    return;
+  }
+  // The draw time reported now belongs to the previous frame.
+  auto lastTime = host->lastDrawTime();
+  if (frameIndex > 0 && lastTime > 0) {
+    runTime += lastTime;
+    runFrames++;
+  }
+  if (runFrames > 0 && runFrames >= runLength()) {
+    lastRunAverage = static_cast<float>(runTime / static_cast<int64_t>(runFrames)) / 1000.f;
+    tgfx::PrintLog("ReplayBench: %s, %zu frames, average time %.2f ms", loadedPath.c_str(),
+                   runFrames, lastRunAverage);
+    runTime = 0;
+    runFrames = 0;
+  }
+  frameIndex++;
+}
+
+void ReplayBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) {
+  canvas->clear(tgfx::Color::White());
+  auto typeface = host->getTypeface("default");
+  if (reader.frameCount() == 0) {
+    tgfx::Paint paint = {};
+    paint.setColor(tgfx::Color::Black());
+    tgfx::Font font(typeface, 30.f * host->density());
+    auto hint = CapturePath.empty() ? "No capture, run with --replay=<file>."
+                                    : "Failed to load " + CapturePath;
+    canvas->drawSimpleText(hint, 20.f * host->density(), height * 0.5f, font, paint);
+    return;
+  }
+  // Scales the captured frames to fit the screen, keeping their aspect ratio.
+  auto scale = std::min(width / static_cast<float>(reader.width()),
+                        height / static_cast<float>(reader.height()));
+  auto matrix = tgfx::Matrix::MakeScale(scale);
+  matrix.postTranslate((width - static_cast<float>(reader.width()) * scale) * 0.5f,
+                       (height - static_cast<float>(reader.height()) * scale) * 0.5f);
+  auto index = static_cast<size_t>(frameIndex - 1) % reader.frameCount();
+  commandCount = reader.playFrame(index, canvas, matrix, typeface);
+}
+
+void ReplayBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  if (reader.frameCount() == 0) {
+    return;
+  }
+  auto index = static_cast<size_t>(std::max(frameIndex - 1, static_cast<int64_t>(0)));
+  lines->push_back("Frame: " + std::to_string(index % reader.frameCount() + 1) + "/" +
+                   std::to_string(reader.frameCount()));
+  lines->push_back("Commands: " + std::to_string(commandCount));
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1) << static_cast<double>(reader.mappedSize()) / 1048576.0;
+  lines->push_back("Mapped: " + oss.str() + "MB");
+  lines->push_back("Cached: " + std::to_string(reader.cachedBlobCount()));
+  if (lastRunAverage > 0) {
+    oss.str("");
+    oss << std::fixed << std::setprecision(2) << lastRunAverage;
+    lines->push_back("Run: " + oss.str());
+  }
+}
+
+}  // namespace benchmark
@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+#include "base/CaptureReader.h"
+
+namespace benchmark {
+
+/**
+ * ReplayBench plays back frames captured from a real app with CaptureCanvas, so production frames
+ * can be benchmarked and attached to performance reports instead of synthetic particles. The
+ * captured frames loop, scaled to fit the screen, and after each run of the replay frame count the
+ * average frame time of the run is printed. The particle count is pinned to one.
+ */
+class ReplayBench : public ParticleBench {
+ public:
+  ReplayBench();
+
+  /**
+   * Sets the path of the capture file to replay. The default is empty, which shows a hint instead.
+   */
+  static void SetCapturePath(const std::string& path);
+
+  /**
+   * Sets the number of frames in each replay run. The default is 0, which uses the number of
+   * frames in the capture.
+   */
+  static void SetReplayFrameCount(size_t count);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+ private:
+  size_t runLength() const;
+
+  CaptureReader reader = {};
+  std::string loadedPath = "";
+  int64_t frameIndex = 0;
+  size_t commandCount = 0;
+  int64_t runTime = 0;
+  size_t runFrames = 0;
+  float lastRunAverage = 0;
+};
+
+}  // namespace benchmark
@@ -0,0 +1,114 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SaveLayerBench.h"
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace benchmark {
+static constexpr float LAYER_ALPHA = 0.8f;
+
+static int LayerCount = 16;
+static float LayerBoundsScale = 0.5f;
+
+static std::string ToString(tgfx::BlendMode mode) {
+  switch (mode) {
+    case tgfx::BlendMode::SrcOver:
+      return "Alpha";
+    case tgfx::BlendMode::Multiply:
+      return "Multiply";
+    case tgfx::BlendMode::Screen:
+      return "Screen";
+    default:
+      return "Unknown";
+  }
+}
+
+SaveLayerBench::SaveLayerBench(tgfx::BlendMode mode)
+    : ParticleBench("SaveLayerBench-" + ToString(mode), GraphicType::Rect), blendMode(mode) {
+}
+
+void SaveLayerBench::SetLayerCount(int count) {
+  LayerCount = std::max(count, 1);
+}
+
+void SaveLayerBench::SetLayerBoundsScale(float scale) {
+  LayerBoundsScale = std::max(0.01f, std::min(scale, 1.f));
+}
+
+tgfx::Rect SaveLayerBench::getLayerBounds(size_t index, size_t layerCount) const {
+  // Spread the layers over a grid so that they overlap each other when the bounds are large.
+  auto columns = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(layerCount))));
+  auto rows = (layerCount + columns - 1) / columns;
+  auto layerWidth = width * LayerBoundsScale;
+  auto layerHeight = height * LayerBoundsScale;
+  auto stepX = columns > 1 ? (width - layerWidth) / static_cast<float>(columns - 1) : 0.f;
+  auto stepY = rows > 1 ? (height - layerHeight) / static_cast<float>(rows - 1) : 0.f;
+  auto x = stepX * static_cast<float>(index % columns);
+  auto y = stepY * static_cast<float>(index / columns);
+  return tgfx::Rect::MakeXYWH(x, y, layerWidth, layerHeight);
+}
+
+void SaveLayerBench::onAnimate(const AppHost*) {
+  auto layerCount = static_cast<size_t>(LayerCount);
+  layerBounds.resize(layerCount);
+  for (size_t layer = 0; layer < layerCount; layer++) {
+    layerBounds[layer] = getLayerBounds(layer, layerCount);
+  }
+  for (size_t i = 0; i < drawCount; i++) {
+    auto& graphic = graphics[i];
+    auto& rect = graphic.rect;
+    auto& bounds = layerBounds[i % layerCount];
+    if (rect.right <= bounds.left || rect.left >= bounds.right || rect.bottom <= bounds.top ||
+        rect.top >= bounds.bottom) {
+      rect.offsetTo(bounds.centerX() - rect.width() * 0.5f,
+                    bounds.centerY() - rect.height() * 0.5f);
+    } else {
+      rect.offset(graphic.speedX, graphic.speedY);
+    }
+  }
+}
+
+void SaveLayerBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  auto layerCount = layerBounds.size();
+  tgfx::Paint layerPaint = {};
+  layerPaint.setAlpha(LAYER_ALPHA);
+  layerPaint.setBlendMode(blendMode);
+  for (size_t layer = 0; layer < layerCount; layer++) {
+    canvas->save();
+    // saveLayer() has no bounds parameter, the layer size is limited by the current clip instead.
+    canvas->clipRect(layerBounds[layer]);
+    canvas->saveLayer(&layerPaint);
+    for (size_t i = layer; i < drawCount; i += layerCount) {
+      canvas->drawRect(graphics[i].rect, paints[i % 3]);
+    }
+    canvas->restore();
+    canvas->restore();
+  }
+}
+
+void SaveLayerBench::onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) {
+  lines->push_back("Layers: " + std::to_string(LayerCount));
+  // Offscreen layers come from the resource cache, so its peak bounds what the layers cost.
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(1)
+      << static_cast<double>(host->peakGPUMemoryUsage()) / 1048576.0;
+  lines->push_back("GPU Peak: " + oss.str() + "MB");
+}
+}  // namespace benchmark
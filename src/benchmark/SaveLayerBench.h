@@ -0,0 +1,60 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+/**
+ * SaveLayerBench splits the particles into groups and draws each group inside an offscreen layer
+ * created by saveLayer(), which is then composited with group opacity and a blend mode. The
+ * particles of each group move inside the bounds of their layer and respawn at its center when
+ * they leave it, so every particle added by the ramp is drawn into the layer.
+ */
+class SaveLayerBench : public ParticleBench {
+ public:
+  explicit SaveLayerBench(tgfx::BlendMode mode);
+
+  /**
+   * Sets the number of layers drawn per frame. The default value is 16.
+   */
+  static void SetLayerCount(int count);
+
+  /**
+   * Sets the size of each layer as a fraction of the screen size, in the range (0, 1]. The default
+   * value is 0.5.
+   */
+  static void SetLayerBoundsScale(float scale);
+
+ protected:
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+ private:
+  tgfx::Rect getLayerBounds(size_t index, size_t layerCount) const;
+
+  tgfx::BlendMode blendMode = tgfx::BlendMode::SrcOver;
+  std::vector<tgfx::Rect> layerBounds = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,511 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SceneBench.h"
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include "base/JSONValue.h"
+#include "tgfx/core/Shader.h"
+#include "tgfx/platform/Print.h"
+
+namespace benchmark {
+// The size of gradients around each particle center in points.
+static constexpr float SHADER_EXTENT = 16.f;
+// The largest count or step a scene may request, well within the range of a size_t.
+static constexpr double MAX_SCENE_COUNT = 100000000.0;
+
+static constexpr char DEFAULT_SCENE[] = R"({
+  "name": "Default",
+  "count": 50000,
+  "primitives": [
+    {"shape": "rect", "weight": 3, "size": [6, 16]},
+    {"shape": "rrect", "weight": 2, "size": [8, 20], "cornerRadius": 0.25},
+    {"shape": "circle", "weight": 2, "size": [6, 14]},
+    {"shape": "star", "weight": 1, "size": [10, 24]}
+  ],
+  "paints": [
+    {"color": "#E8453C"},
+    {"color": "#3C8CE8", "style": "stroke", "strokeWidth": 2},
+    {"shader": {"type": "linear", "colors": ["#F5B700", "#00A1E4"]}},
+    {"color": "#2BB673", "alpha": 0.6, "blendMode": "multiply"}
+  ],
+  "motion": {"type": "orbit", "speed": 1},
+  "transform": {"rotation": 360, "rotationSpeed": 2},
+  "clip": {"shape": "circle", "inset": 0.05}
+})";
+
+enum class SceneShape { Rect, RRect, Oval, Circle, Star, Image };
+
+enum class SceneMotion { Linear, Orbit, Static };
+
+enum class SceneClip { None, Rect, Circle };
+
+enum class SceneShader { None, Linear, Radial };
+
+struct ScenePrimitive {
+  SceneShape shape = SceneShape::Rect;
+  float weight = 1.f;
+  float minSize = 4.f;
+  float maxSize = 14.f;
+  float cornerRadius = 0.25f;
+};
+
+struct ScenePaint {
+  tgfx::Color color = tgfx::Color::Black();
+  tgfx::PaintStyle style = tgfx::PaintStyle::Fill;
+  float strokeWidth = 1.f;
+  bool antiAlias = true;
+  tgfx::BlendMode blendMode = tgfx::BlendMode::SrcOver;
+  SceneShader shader = SceneShader::None;
+  std::vector<tgfx::Color> shaderColors = {};
+};
+
+struct Scene {
+  std::string name = "Untitled";
+  bool hasBackground = false;
+  tgfx::Color background = tgfx::Color::White();
+  size_t count = 0;
+  size_t step = 0;
+  bool fixedCount = false;
+  std::vector<ScenePrimitive> primitives = {};
+  std::vector<ScenePaint> paints = {};
+  SceneMotion motion = SceneMotion::Linear;
+  float speed = 1.f;
+  float rotation = 0.f;
+  float rotationSpeed = 0.f;
+  float scale = 1.f;
+  SceneClip clip = SceneClip::None;
+  float clipInset = 0.f;
+  std::string imageName = "bridge";
+};
+
+static bool ParseHex(const std::string& text, size_t start, uint8_t* value) {
+  int result = 0;
+  for (size_t i = start; i < start + 2; i++) {
+    auto c = text[i];
+    int digit = 0;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      digit = c - 'A' + 10;
+    } else {
+      return false;
+    }
+    result = result * 16 + digit;
+  }
+  *value = static_cast<uint8_t>(result);
+  return true;
+}
+
+// Parses "#RRGGBB" or "#RRGGBBAA", returning the default for anything else.
+static tgfx::Color ParseColor(const JSONValue& value, const tgfx::Color& defaultColor) {
+  auto text = value.asString();
+  if (text.size() != 7 && text.size() != 9) {
+    return defaultColor;
+  }
+  uint8_t channels[4] = {0, 0, 0, 255};
+  for (size_t i = 0; i * 2 + 1 < text.size(); i++) {
+    if (text[0] != '#' || !ParseHex(text, i * 2 + 1, &channels[i])) {
+      return defaultColor;
+    }
+  }
+  return tgfx::Color::FromRGBA(channels[0], channels[1], channels[2], channels[3]);
+}
+
+static size_t ParseCount(const JSONValue& value) {
+  // strtod() accepts huge, infinite and NaN values, none of which fit in a size_t. The count is
+  // capped again by maxDrawCount(), which also honors a later SetMaxDrawCount() call.
+  auto number = value.asNumber(0);
+  if (!std::isfinite(number) || number <= 0) {
+    return 0;
+  }
+  return static_cast<size_t>(std::min(number, MAX_SCENE_COUNT));
+}
+
+static SceneShape ParseShape(const std::string& name) {
+  if (name == "rrect") {
+    return SceneShape::RRect;
+  }
+  if (name == "oval") {
+    return SceneShape::Oval;
+  }
+  if (name == "circle") {
+    return SceneShape::Circle;
+  }
+  if (name == "star") {
+    return SceneShape::Star;
+  }
+  if (name == "image") {
+    return SceneShape::Image;
+  }
+  return SceneShape::Rect;
+}
+
+static tgfx::BlendMode ParseBlendMode(const std::string& name) {
+  static const std::pair<const char*, tgfx::BlendMode> blendModes[] = {
+      {"multiply", tgfx::BlendMode::Multiply},     {"screen", tgfx::BlendMode::Screen},
+      {"overlay", tgfx::BlendMode::Overlay},       {"darken", tgfx::BlendMode::Darken},
+      {"lighten", tgfx::BlendMode::Lighten},       {"difference", tgfx::BlendMode::Difference},
+      {"plus", tgfx::BlendMode::PlusLighter},      {"xor", tgfx::BlendMode::Xor},
+      {"colorDodge", tgfx::BlendMode::ColorDodge}, {"colorBurn", tgfx::BlendMode::ColorBurn}};
+  for (auto& item : blendModes) {
+    if (name == item.first) {
+      return item.second;
+    }
+  }
+  return tgfx::BlendMode::SrcOver;
+}
+
+static ScenePaint ParsePaint(const JSONValue& value) {
+  ScenePaint paint = {};
+  paint.color = ParseColor(value.get("color"), paint.color);
+  paint.color.alpha *= value.get("alpha").asFloat(1.f);
+  if (value.get("style").asString() == "stroke") {
+    paint.style = tgfx::PaintStyle::Stroke;
+  }
+  paint.strokeWidth = value.get("strokeWidth").asFloat(paint.strokeWidth);
+  paint.antiAlias = value.get("antiAlias").asBool(paint.antiAlias);
+  paint.blendMode = ParseBlendMode(value.get("blendMode").asString());
+  auto& shader = value.get("shader");
+  auto shaderType = shader.get("type").asString();
+  auto& colors = shader.get("colors");
+  if ((shaderType == "linear" || shaderType == "radial") && colors.size() >= 2) {
+    paint.shader = shaderType == "linear" ? SceneShader::Linear : SceneShader::Radial;
+    for (size_t i = 0; i < colors.size(); i++) {
+      paint.shaderColors.push_back(ParseColor(colors.at(i), tgfx::Color::Black()));
+    }
+  }
+  return paint;
+}
+
+static Scene ParseScene(const JSONValue& root) {
+  Scene scene = {};
+  scene.name = root.get("name").asString(scene.name);
+  scene.hasBackground = !root.get("background").isNull();
+  scene.background = ParseColor(root.get("background"), scene.background);
+  scene.count = ParseCount(root.get("count"));
+  scene.step = ParseCount(root.get("step"));
+  scene.fixedCount = root.get("fixedCount").asBool(false);
+  auto& primitives = root.get("primitives");
+  for (size_t i = 0; i < primitives.size(); i++) {
+    auto& item = primitives.at(i);
+    ScenePrimitive primitive = {};
+    primitive.shape = ParseShape(item.get("shape").asString());
+    primitive.weight = std::max(item.get("weight").asFloat(1.f), 0.f);
+    auto& size = item.get("size");
+    primitive.minSize = std::max(size.at(0).asFloat(primitive.minSize), 1.f);
+    primitive.maxSize = std::max(size.at(1).asFloat(primitive.minSize), primitive.minSize);
+    primitive.cornerRadius = item.get("cornerRadius").asFloat(primitive.cornerRadius);
+    scene.primitives.push_back(primitive);
+  }
+  if (scene.primitives.empty()) {
+    scene.primitives.emplace_back();
+  }
+  auto& paints = root.get("paints");
+  for (size_t i = 0; i < paints.size(); i++) {
+    scene.paints.push_back(ParsePaint(paints.at(i)));
+  }
+  if (scene.paints.empty()) {
+    scene.paints.emplace_back();
+  }
+  auto& motion = root.get("motion");
+  auto motionType = motion.get("type").asString();
+  if (motionType == "orbit") {
+    scene.motion = SceneMotion::Orbit;
+  } else if (motionType == "static") {
+    scene.motion = SceneMotion::Static;
+  }
+  scene.speed = motion.get("speed").asFloat(scene.speed);
+  auto& transform = root.get("transform");
+  scene.rotation = transform.get("rotation").asFloat(scene.rotation);
+  scene.rotationSpeed = transform.get("rotationSpeed").asFloat(scene.rotationSpeed);
+  scene.scale = transform.get("scale").asFloat(scene.scale);
+  auto& clip = root.get("clip");
+  auto clipShape = clip.get("shape").asString();
+  if (clipShape == "rect") {
+    scene.clip = SceneClip::Rect;
+  } else if (clipShape == "circle") {
+    scene.clip = SceneClip::Circle;
+  }
+  scene.clipInset = std::min(std::max(clip.get("inset").asFloat(0.f), 0.f), 0.45f);
+  scene.imageName = root.get("image").asString(scene.imageName);
+  return scene;
+}
+
+static Scene& CurrentScene() {
+  static Scene scene = [] {
+    JSONValue root = {};
+    std::string error = "";
+    JSONValue::Parse(DEFAULT_SCENE, &root, &error);
+    return ParseScene(root);
+  }();
+  return scene;
+}
+
+static tgfx::Path CreateStar(float size) {
+  const int points = 5;
+  auto outerRadius = size * 0.5f;
+  auto innerRadius = outerRadius * 0.382f;
+  auto angleStep = static_cast<float>(M_PI) / points;
+  tgfx::Path path;
+  for (int j = 0; j < points * 2; j++) {
+    auto radius = (j % 2 == 0) ? outerRadius : innerRadius;
+    auto angle = static_cast<float>(j) * angleStep;
+    auto x = radius * std::sin(angle);
+    auto y = -radius * std::cos(angle);
+    if (j == 0) {
+      path.moveTo(x, y);
+    } else {
+      path.lineTo(x, y);
+    }
+  }
+  path.close();
+  return path;
+}
+
+static tgfx::Paint CreatePaint(const ScenePaint& scenePaint, float density) {
+  tgfx::Paint paint = {};
+  paint.setColor(scenePaint.color);
+  paint.setStyle(scenePaint.style);
+  paint.setStrokeWidth(scenePaint.strokeWidth * density);
+  paint.setAntiAlias(scenePaint.antiAlias);
+  paint.setBlendMode(scenePaint.blendMode);
+  auto extent = SHADER_EXTENT * density * 0.5f;
+  std::vector<float> positions = {};
+  if (scenePaint.shader == SceneShader::Linear) {
+    paint.setShader(tgfx::Shader::MakeLinearGradient(tgfx::Point::Make(-extent, -extent),
+                                                     tgfx::Point::Make(extent, extent),
+                                                     scenePaint.shaderColors, positions));
+  } else if (scenePaint.shader == SceneShader::Radial) {
+    paint.setShader(tgfx::Shader::MakeRadialGradient(tgfx::Point::Make(0, 0), extent,
+                                                     scenePaint.shaderColors, positions));
+  }
+  return paint;
+}
+
+bool SceneBench::LoadScene(const std::string& path) {
+  std::ifstream file(path);
+  if (!file) {
+    tgfx::PrintError("SceneBench::LoadScene() failed to read %s!", path.c_str());
+    return false;
+  }
+  std::stringstream stream;
+  stream << file.rdbuf();
+  return SetSceneJSON(stream.str());
+}
+
+bool SceneBench::SetSceneJSON(const std::string& json) {
+  JSONValue root = {};
+  std::string error = "";
+  if (!JSONValue::Parse(json, &root, &error)) {
+    tgfx::PrintError("SceneBench::SetSceneJSON() invalid JSON: %s", error.c_str());
+    return false;
+  }
+  if (!root.isObject()) {
+    tgfx::PrintError("SceneBench::SetSceneJSON() the scene must be a JSON object!");
+    return false;
+  }
+  CurrentScene() = ParseScene(root);
+  return true;
+}
+
+SceneBench::SceneBench() : ParticleBench("SceneBench", GraphicType::Rect) {
+}
+
+size_t SceneBench::maxDrawCount() const {
+  auto& scene = CurrentScene();
+  if (scene.count == 0) {
+    return ParticleBench::maxDrawCount();
+  }
+  return std::min(ParticleBench::maxDrawCount(), scene.count);
+}
+
+size_t SceneBench::increaseStep() const {
+  auto& scene = CurrentScene();
+  return scene.step > 0 ? scene.step : ParticleBench::increaseStep();
+}
+
+void SceneBench::onInit(const AppHost* host) {
+  auto& scene = CurrentScene();
+  auto density = host->density();
+  sceneName = scene.name;
+  image = scene.imageName.empty() ? nullptr : host->getImage(scene.imageName);
+  scenePaints.clear();
+  useLocalMatrix = scene.rotation != 0 || scene.rotationSpeed != 0 || scene.scale != 1.f;
+  for (auto& paint : scene.paints) {
+    scenePaints.push_back(CreatePaint(paint, density));
+    useLocalMatrix = useLocalMatrix || paint.shader != SceneShader::None;
+  }
+  float totalWeight = 0;
+  for (auto& primitive : scene.primitives) {
+    totalWeight += primitive.weight;
+  }
+  auto maxCount = maxDrawCount();
+  particles.resize(maxCount);
+  starPaths.clear();
+  starPaths.resize(maxCount);
+  std::mt19937 rng(47);
+  std::uniform_real_distribution<float> distribution(0, 1);
+  auto minSide = std::min(width, height);
+  for (size_t i = 0; i < maxCount; i++) {
+    auto& particle = particles[i];
+    auto pick = distribution(rng) * totalWeight;
+    particle.primitive = scene.primitives.size() - 1;
+    for (size_t j = 0; j < scene.primitives.size(); j++) {
+      pick -= scene.primitives[j].weight;
+      if (pick < 0) {
+        particle.primitive = j;
+        break;
+      }
+    }
+    particle.paint = i % scenePaints.size();
+    auto& primitive = scene.primitives[particle.primitive];
+    auto size = (primitive.minSize + distribution(rng) * (primitive.maxSize - primitive.minSize)) *
+                density;
+    auto aspect = primitive.shape == SceneShape::Oval ? 0.8f : 1.f;
+    auto& graphic = graphics[i];
+    graphic.speedX *= scene.speed;
+    graphic.speedY *= scene.speed;
+    // Linear particles start off the screen and spawn at the start point.
+    graphic.rect.setXYWH(-size, -size, size, size * aspect);
+    if (scene.motion == SceneMotion::Static) {
+      auto x = distribution(rng) * (width - size);
+      graphic.rect.offsetTo(x, distribution(rng) * (height - size));
+    }
+    if (primitive.shape == SceneShape::Star) {
+      starPaths[i] = CreateStar(size);
+    }
+    particle.rotation = distribution(rng) * scene.rotation;
+    particle.orbitRadius = (0.05f + distribution(rng) * 0.4f) * minSide;
+    particle.orbitAngle = distribution(rng) * 2.f * static_cast<float>(M_PI);
+    // Inner particles orbit faster, as they would around a mass at the center.
+    particle.orbitSpeed = scene.speed * 0.01f * std::sqrt(0.45f * minSide / particle.orbitRadius);
+  }
+  auto inset = minSide * scene.clipInset;
+  auto clipBounds = tgfx::Rect::MakeWH(width, height);
+  clipBounds.inset(inset, inset);
+  clipPath.reset();
+  if (scene.clip == SceneClip::Rect) {
+    clipPath.addRect(clipBounds);
+  } else if (scene.clip == SceneClip::Circle) {
+    auto radius = minSide * 0.5f - inset;
+    clipPath.addOval(tgfx::Rect::MakeXYWH(width * 0.5f - radius, height * 0.5f - radius,
+                                          radius * 2.f, radius * 2.f));
+  }
+  if (scene.fixedCount) {
+    drawCount = maxCount;
+  }
+}
+
+void SceneBench::onAnimate(const AppHost* host) {
+  auto& scene = CurrentScene();
+  if (scene.motion == SceneMotion::Linear) {
+    ParticleBench::onAnimate(host);
+  } else if (scene.motion == SceneMotion::Orbit) {
+    auto centerX = width * 0.5f;
+    auto centerY = height * 0.5f;
+    for (size_t i = 0; i < drawCount; i++) {
+      auto& particle = particles[i];
+      auto& rect = graphics[i].rect;
+      particle.orbitAngle += particle.orbitSpeed;
+      rect.offsetTo(centerX + particle.orbitRadius * std::cos(particle.orbitAngle) -
+                        rect.width() * 0.5f,
+                    centerY + particle.orbitRadius * std::sin(particle.orbitAngle) -
+                        rect.height() * 0.5f);
+    }
+  }
+  if (scene.rotationSpeed != 0) {
+    for (size_t i = 0; i < drawCount; i++) {
+      particles[i].rotation += scene.rotationSpeed;
+    }
+  }
+}
+
+void SceneBench::drawParticle(tgfx::Canvas* canvas, size_t index) const {
+  auto& scene = CurrentScene();
+  auto& particle = particles[index];
+  auto& primitive = scene.primitives[particle.primitive];
+  auto& paint = scenePaints[particle.paint];
+  auto bounds = graphics[index].rect;
+  if (useLocalMatrix || primitive.shape == SceneShape::Star) {
+    auto matrix = tgfx::Matrix::MakeTrans(bounds.centerX(), bounds.centerY());
+    matrix.preRotate(particle.rotation);
+    matrix.preScale(scene.scale, scene.scale);
+    canvas->setMatrix(matrix);
+    bounds.offset(-bounds.centerX(), -bounds.centerY());
+  }
+  switch (primitive.shape) {
+    case SceneShape::Rect:
+      canvas->drawRect(bounds, paint);
+      break;
+    case SceneShape::RRect: {
+      auto radius = std::min(bounds.width(), bounds.height()) * primitive.cornerRadius;
+      canvas->drawRoundRect(bounds, radius, radius, paint);
+      break;
+    }
+    case SceneShape::Oval:
+      canvas->drawOval(bounds, paint);
+      break;
+    case SceneShape::Circle:
+      canvas->drawCircle(bounds.centerX(), bounds.centerY(), bounds.width() * 0.5f, paint);
+      break;
+    case SceneShape::Star:
+      canvas->drawPath(starPaths[index], paint);
+      if (!useLocalMatrix) {
+        // The following particles draw in screen space and expect an identity matrix.
+        canvas->resetMatrix();
+      }
+      break;
+    case SceneShape::Image:
+      if (image != nullptr) {
+        canvas->drawImageRect(image, bounds, tgfx::SamplingOptions(tgfx::FilterMode::Linear),
+                              &paint);
+      } else {
+        canvas->drawRect(bounds, paint);
+      }
+      break;
+  }
+}
+
+void SceneBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  auto& scene = CurrentScene();
+  if (scene.hasBackground) {
+    canvas->clear(scene.background);
+  }
+  canvas->save();
+  if (!clipPath.isEmpty()) {
+    canvas->clipPath(clipPath);
+  }
+  for (size_t i = 0; i < drawCount; i++) {
+    drawParticle(canvas, i);
+  }
+  canvas->restore();
+  if (scene.motion == SceneMotion::Linear) {
+    canvas->drawRect(startRect, {});
+  }
+}
+
+void SceneBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  lines->push_back("Scene: " + sceneName);
+}
+
+}  // namespace benchmark
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+/**
+ * SceneBench draws a workload described by a JSON scene file, so new stress scenes can be authored
+ * and shared without writing C++. A scene sets the mix of primitive shapes, the paints, the motion
+ * model, per-particle transforms and a clip, see the Scene Files section of README.md for the
+ * format. The scene is parsed when it is set, and all per-particle data, paths and paints are built
+ * when the bench resets, so drawing a frame involves no parsing or allocation. Without a scene
+ * file, a built-in scene is drawn.
+ */
+class SceneBench : public ParticleBench {
+ public:
+  SceneBench();
+
+  /**
+   * Loads the scene from the JSON file at the given path. Returns false and keeps the current scene
+   * if the file cannot be read or parsed.
+   */
+  static bool LoadScene(const std::string& path);
+
+  /**
+   * Sets the scene from the given JSON text. Returns false and keeps the current scene if the text
+   * cannot be parsed.
+   */
+  static bool SetSceneJSON(const std::string& json);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+  size_t increaseStep() const override;
+
+ private:
+  struct SceneParticle {
+    size_t primitive = 0;
+    size_t paint = 0;
+    float rotation = 0;
+    float orbitRadius = 0;
+    float orbitAngle = 0;
+    float orbitSpeed = 0;
+  };
+
+  void drawParticle(tgfx::Canvas* canvas, size_t index) const;
+
+  std::vector<SceneParticle> particles = {};
+  std::vector<tgfx::Paint> scenePaints = {};
+  bool useLocalMatrix = false;
+  std::vector<tgfx::Path> starPaths = {};
+  std::shared_ptr<tgfx::Image> image = nullptr;
+  tgfx::Path clipPath = {};
+  std::string sceneName = "";
+};
+
+}  // namespace benchmark
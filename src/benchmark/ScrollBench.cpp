@@ -0,0 +1,318 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ScrollBench.h"
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include "tgfx/core/Surface.h"
+
+namespace benchmark {
+static constexpr size_t WORLD_OBJECT_COUNT = 200000;
+static constexpr float WORLD_SCALE_X = 4.f;
+static constexpr float WORLD_SCALE_Y = 16.f;
+static constexpr float OBJECT_SCALE = 4.f;
+static constexpr int TILE_SIZE = 256;
+static constexpr float ZOOM_LEVELS[] = {1.f, 1.5f, 2.f, 3.f};
+static constexpr size_t ZOOM_LEVEL_COUNT = sizeof(ZOOM_LEVELS) / sizeof(ZOOM_LEVELS[0]);
+// The camera script: a fling every FLING_FRAMES, a zoom step every ZOOM_FRAMES and a jump every
+// JUMP_FRAMES, each phase lasting three of its steps.
+static constexpr int64_t FLING_FRAMES = 80;
+static constexpr int64_t ZOOM_FRAMES = 40;
+static constexpr int64_t JUMP_FRAMES = 30;
+static constexpr int64_t PHASE_STEPS = 3;
+static constexpr float FLING_VELOCITY = 80.f;
+static constexpr float FLING_FRICTION = 0.96f;
+
+static int TileBudget = 64;
+
+static std::string ToString(ScrollMode mode) {
+  switch (mode) {
+    case ScrollMode::Direct:
+      return "Direct";
+    case ScrollMode::Tiled:
+      return "Tiled";
+    default:
+      return "Unknown";
+  }
+}
+
+ScrollBench::ScrollBench(ScrollMode mode)
+    : ParticleBench("ScrollBench-" + ToString(mode), GraphicType::Rect), scrollMode(mode) {
+}
+
+void ScrollBench::SetTileBudget(int budget) {
+  TileBudget = std::max(budget, 1);
+}
+
+size_t ScrollBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), WORLD_OBJECT_COUNT);
+}
+
+void ScrollBench::onInit(const AppHost* host) {
+  worldWidth = width * WORLD_SCALE_X;
+  worldHeight = height * WORLD_SCALE_Y;
+  // The world content has a fixed size, so skip the draw count ramp. The Count line then shows the
+  // whole world, and onUpdateStatus() reports what was actually drawn.
+  drawCount = maxDrawCount();
+  std::mt19937 positionRng(54);
+  std::uniform_real_distribution<float> xDistribution(0, worldWidth);
+  std::uniform_real_distribution<float> yDistribution(0, worldHeight);
+  float maxObjectSize = 0;
+  for (size_t i = 0; i < drawCount; i++) {
+    auto& rect = graphics[i].rect;
+    rect.setXYWH(xDistribution(positionRng), yDistribution(positionRng),
+                 rect.width() * OBJECT_SCALE, rect.height() * OBJECT_SCALE);
+    maxObjectSize = std::max(maxObjectSize, std::max(rect.width(), rect.height()));
+  }
+  // Bin the objects by their top-left corner. Queries expand their rect by the largest object size,
+  // so that every object is found exactly once.
+  binSize = 4 * maxObjectSize;
+  binColumns = static_cast<size_t>(std::ceil(worldWidth / binSize));
+  auto binRows = static_cast<size_t>(std::ceil(worldHeight / binSize));
+  bins.assign(binColumns * binRows, {});
+  for (size_t i = 0; i < drawCount; i++) {
+    auto& rect = graphics[i].rect;
+    auto column = std::min(static_cast<size_t>(rect.left / binSize), binColumns - 1);
+    auto row = std::min(static_cast<size_t>(rect.top / binSize), binRows - 1);
+    bins[row * binColumns + column].push_back(static_cast<uint32_t>(i));
+  }
+  labels.clear();
+  for (int i = 0; i < 100; i++) {
+    labels.push_back("Item " + std::to_string(i));
+  }
+  labelFont = tgfx::Font(host->getTypeface("default"), 12.f * host->density());
+  image = host->getImage("bridge");
+  if (image != nullptr) {
+    image = image->makeMipmapped(true);
+  }
+  backgroundPaint.setColor(tgfx::Color::White());
+  tileSize = static_cast<int>(static_cast<float>(TILE_SIZE) * host->density());
+  tileOrder.clear();
+  tiles.clear();
+  tileMisses = 0;
+  frameIndex = 0;
+  phase = Phase::Fling;
+  lastPhase = Phase::Fling;
+  viewOrigin = {};
+  velocity = 0;
+  zoomIndex = 0;
+  jumpSeed = 0;
+  visibleCount = 0;
+  for (int i = 0; i < 3; i++) {
+    phaseTimes[i] = 0;
+    phaseFrames[i] = 0;
+  }
+}
+
+void ScrollBench::onAnimate(const AppHost* host) {
+  // The draw time reported now belongs to the previous frame.
+  auto lastTime = host->lastDrawTime();
+  if (lastTime > 0) {
+    phaseTimes[static_cast<int>(lastPhase)] += lastTime;
+    phaseFrames[static_cast<int>(lastPhase)]++;
+  }
+  lastPhase = phase;
+  auto flingLength = FLING_FRAMES * PHASE_STEPS;
+  auto zoomLength = ZOOM_FRAMES * PHASE_STEPS;
+  auto jumpLength = JUMP_FRAMES * PHASE_STEPS;
+  auto cycleFrame = frameIndex % (flingLength + zoomLength + jumpLength);
+  frameIndex++;
+  auto zoom = ZOOM_LEVELS[zoomIndex];
+  if (cycleFrame < flingLength) {
+    phase = Phase::Fling;
+    zoomIndex = 0;
+    zoom = ZOOM_LEVELS[zoomIndex];
+    if (cycleFrame % FLING_FRAMES == 0) {
+      auto direction = (cycleFrame / FLING_FRAMES) % 2 == 0 ? 1.f : -1.f;
+      velocity = direction * FLING_VELOCITY * (width / 1024.f);
+    }
+    viewOrigin.y += velocity / zoom;
+    velocity *= FLING_FRICTION;
+  } else if (cycleFrame < flingLength + zoomLength) {
+    phase = Phase::Zoom;
+    if ((cycleFrame - flingLength) % ZOOM_FRAMES == 0) {
+      // Zoom in by one step, keeping the center of the screen still.
+      auto centerX = viewOrigin.x + width * 0.5f / zoom;
+      auto centerY = viewOrigin.y + height * 0.5f / zoom;
+      zoomIndex = (zoomIndex + 1) % ZOOM_LEVEL_COUNT;
+      zoom = ZOOM_LEVELS[zoomIndex];
+      viewOrigin.x = centerX - width * 0.5f / zoom;
+      viewOrigin.y = centerY - height * 0.5f / zoom;
+    }
+  } else {
+    phase = Phase::Jump;
+    zoomIndex = 0;
+    zoom = ZOOM_LEVELS[zoomIndex];
+    if ((cycleFrame - flingLength - zoomLength) % JUMP_FRAMES == 0) {
+      std::mt19937 jumpRng(jumpSeed++);
+      std::uniform_real_distribution<float> distribution(0, 1);
+      viewOrigin.x = distribution(jumpRng) * worldWidth;
+      viewOrigin.y = distribution(jumpRng) * worldHeight;
+    }
+  }
+  auto maxX = std::max(worldWidth - width / zoom, 0.f);
+  auto maxY = std::max(worldHeight - height / zoom, 0.f);
+  if (viewOrigin.y < 0 || viewOrigin.y > maxY) {
+    velocity = -velocity;
+  }
+  viewOrigin.x = std::max(0.f, std::min(viewOrigin.x, maxX));
+  viewOrigin.y = std::max(0.f, std::min(viewOrigin.y, maxY));
+}
+
+size_t ScrollBench::drawObjects(tgfx::Canvas* canvas, const tgfx::Rect& worldRect) const {
+  auto queryRect = worldRect;
+  queryRect.outset(binSize * 0.25f, binSize * 0.25f);
+  auto binRows = bins.size() / binColumns;
+  auto left = static_cast<size_t>(std::max(queryRect.left / binSize, 0.f));
+  auto top = static_cast<size_t>(std::max(queryRect.top / binSize, 0.f));
+  auto right = std::min(static_cast<size_t>(std::max(queryRect.right / binSize, 0.f)) + 1,
+                        binColumns);
+  auto bottom = std::min(static_cast<size_t>(std::max(queryRect.bottom / binSize, 0.f)) + 1,
+                         binRows);
+  canvas->drawRect(worldRect, backgroundPaint);
+  size_t count = 0;
+  for (auto row = top; row < bottom; row++) {
+    for (auto column = left; column < right; column++) {
+      for (auto index : bins[row * binColumns + column]) {
+        auto& rect = graphics[index].rect;
+        if (!rect.intersects(worldRect)) {
+          continue;
+        }
+        count++;
+        auto& paint = paints[index % 3];
+        switch (index % 5) {
+          case 0:
+            canvas->drawRect(rect, paint);
+            break;
+          case 1:
+            canvas->drawRoundRect(rect, rect.width() * 0.2f, rect.width() * 0.2f, paint);
+            break;
+          case 2:
+            canvas->drawOval(rect, paint);
+            break;
+          case 3:
+            canvas->drawSimpleText(labels[index % labels.size()], rect.left, rect.bottom,
+                                   labelFont, paint);
+            break;
+          default:
+            if (image != nullptr) {
+              canvas->drawImageRect(image, rect);
+            }
+            break;
+        }
+      }
+    }
+  }
+  return count;
+}
+
+std::shared_ptr<tgfx::Image> ScrollBench::getTile(tgfx::Context* context, int tileX, int tileY) {
+  auto key = (static_cast<uint64_t>(zoomIndex) << 56) |
+             (static_cast<uint64_t>(static_cast<uint32_t>(tileX) & 0x0FFFFFFF) << 28) |
+             (static_cast<uint64_t>(static_cast<uint32_t>(tileY) & 0x0FFFFFFF));
+  auto result = tiles.find(key);
+  if (result != tiles.end()) {
+    tileOrder.splice(tileOrder.begin(), tileOrder, result->second.position);
+    return result->second.image;
+  }
+  auto surface = tgfx::Surface::Make(context, tileSize, tileSize);
+  if (surface == nullptr) {
+    return nullptr;
+  }
+  auto zoom = ZOOM_LEVELS[zoomIndex];
+  auto tileWorldSize = static_cast<float>(tileSize) / zoom;
+  auto tileRect = tgfx::Rect::MakeXYWH(static_cast<float>(tileX) * tileWorldSize,
+                                       static_cast<float>(tileY) * tileWorldSize, tileWorldSize,
+                                       tileWorldSize);
+  auto tileCanvas = surface->getCanvas();
+  tileCanvas->scale(zoom, zoom);
+  tileCanvas->translate(-tileRect.left, -tileRect.top);
+  drawObjects(tileCanvas, tileRect);
+  auto image = surface->makeImageSnapshot();
+  tileMisses++;
+  tileOrder.push_front(key);
+  tiles[key] = {image, tileOrder.begin()};
+  while (tiles.size() > static_cast<size_t>(TileBudget)) {
+    tiles.erase(tileOrder.back());
+    tileOrder.pop_back();
+  }
+  return image;
+}
+
+size_t ScrollBench::drawTiles(tgfx::Canvas* canvas, const tgfx::Rect& worldRect) {
+  auto surface = canvas->getSurface();
+  if (surface == nullptr || surface->getContext() == nullptr) {
+    return 0;
+  }
+  auto context = surface->getContext();
+  auto zoom = ZOOM_LEVELS[zoomIndex];
+  auto tileWorldSize = static_cast<float>(tileSize) / zoom;
+  auto left = static_cast<int>(std::floor(worldRect.left / tileWorldSize));
+  auto top = static_cast<int>(std::floor(worldRect.top / tileWorldSize));
+  auto right = static_cast<int>(std::ceil(worldRect.right / tileWorldSize));
+  auto bottom = static_cast<int>(std::ceil(worldRect.bottom / tileWorldSize));
+  size_t count = 0;
+  for (int tileY = top; tileY < bottom; tileY++) {
+    for (int tileX = left; tileX < right; tileX++) {
+      auto tile = getTile(context, tileX, tileY);
+      if (tile == nullptr) {
+        continue;
+      }
+      // Tiles are rasterized at the current zoom, so they are drawn without scaling.
+      auto x = std::round((static_cast<float>(tileX) * tileWorldSize - viewOrigin.x) * zoom);
+      auto y = std::round((static_cast<float>(tileY) * tileWorldSize - viewOrigin.y) * zoom);
+      canvas->drawImage(tile, x, y);
+      count++;
+    }
+  }
+  return count;
+}
+
+void ScrollBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  auto zoom = ZOOM_LEVELS[zoomIndex];
+  auto worldRect = tgfx::Rect::MakeXYWH(viewOrigin.x, viewOrigin.y, width / zoom, height / zoom);
+  if (scrollMode == ScrollMode::Tiled) {
+    visibleCount = drawTiles(canvas, worldRect);
+    return;
+  }
+  canvas->save();
+  canvas->scale(zoom, zoom);
+  canvas->translate(-viewOrigin.x, -viewOrigin.y);
+  visibleCount = drawObjects(canvas, worldRect);
+  canvas->restore();
+}
+
+void ScrollBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  static const char* phaseNames[] = {"Fling", "Zoom", "Jump"};
+  for (int i = 0; i < 3; i++) {
+    auto averageTime = phaseFrames[i] > 0 ? phaseTimes[i] / phaseFrames[i] : 0;
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1) << static_cast<float>(averageTime) / 1000.f;
+    lines->push_back(std::string(phaseNames[i]) + ": " + oss.str());
+  }
+  if (scrollMode == ScrollMode::Direct) {
+    lines->push_back("Visible: " + std::to_string(visibleCount));
+  } else {
+    lines->push_back("Visible: " + std::to_string(visibleCount) + " tiles");
+    lines->push_back("Tiles: " + std::to_string(tiles.size()) + "/" + std::to_string(TileBudget));
+    lines->push_back("Misses: " + std::to_string(tileMisses));
+  }
+}
+}  // namespace benchmark
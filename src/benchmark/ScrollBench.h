@@ -0,0 +1,101 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <list>
+#include <unordered_map>
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+enum class ScrollMode { Direct, Tiled };
+
+/**
+ * ScrollBench pans and zooms over a virtual world much larger than the screen, filled with mixed
+ * content. A scripted camera cycles through flings, zoom steps and jumps to cold locations. The
+ * Direct mode draws the visible content every frame, while the Tiled mode rasterizes it into
+ * cached tiles and draws the tiles. The world always holds the same number of objects, so the
+ * particle count is fixed rather than ramped up, and the status bar reports how many objects or
+ * tiles were actually drawn in the last frame.
+ */
+class ScrollBench : public ParticleBench {
+ public:
+  explicit ScrollBench(ScrollMode mode);
+
+  /**
+   * Sets the maximum number of tiles kept in the tile cache. The default value is 64.
+   */
+  static void SetTileBudget(int budget);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+ private:
+  enum class Phase { Fling, Zoom, Jump };
+
+  struct Tile {
+    std::shared_ptr<tgfx::Image> image = nullptr;
+    // The position of this tile in the least-recently-used order.
+    std::list<uint64_t>::iterator position = {};
+  };
+
+  size_t drawObjects(tgfx::Canvas* canvas, const tgfx::Rect& worldRect) const;
+
+  size_t drawTiles(tgfx::Canvas* canvas, const tgfx::Rect& worldRect);
+
+  std::shared_ptr<tgfx::Image> getTile(tgfx::Context* context, int tileX, int tileY);
+
+  ScrollMode scrollMode = ScrollMode::Direct;
+  float worldWidth = 0;
+  float worldHeight = 0;
+  float binSize = 0;
+  size_t binColumns = 0;
+  std::vector<std::vector<uint32_t>> bins = {};
+  std::vector<std::string> labels = {};
+  tgfx::Font labelFont = {};
+  std::shared_ptr<tgfx::Image> image = nullptr;
+  tgfx::Paint backgroundPaint = {};
+
+  int64_t frameIndex = 0;
+  Phase phase = Phase::Fling;
+  tgfx::Point viewOrigin = {};
+  float velocity = 0;
+  size_t zoomIndex = 0;
+  uint32_t jumpSeed = 0;
+  size_t visibleCount = 0;
+
+  int tileSize = 256;
+  std::list<uint64_t> tileOrder = {};
+  std::unordered_map<uint64_t, Tile> tiles = {};
+  size_t tileMisses = 0;
+
+  Phase lastPhase = Phase::Fling;
+  int64_t phaseTimes[3] = {};
+  int64_t phaseFrames[3] = {};
+};
+
+}  // namespace benchmark
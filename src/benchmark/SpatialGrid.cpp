@@ -0,0 +1,87 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace benchmark {
+void SpatialGrid::reset(const tgfx::Rect& worldRect, float size) {
+  world = worldRect;
+  cellSize = std::max(size, 1.f);
+  columns = std::max(static_cast<int>(std::ceil(world.width() / cellSize)), 1);
+  rows = std::max(static_cast<int>(std::ceil(world.height() / cellSize)), 1);
+  cells.assign(static_cast<size_t>(columns * rows), {});
+  slots.clear();
+}
+
+uint32_t SpatialGrid::getCell(const tgfx::Rect& bounds) const {
+  auto column = static_cast<int>(std::floor((bounds.centerX() - world.left) / cellSize));
+  auto row = static_cast<int>(std::floor((bounds.centerY() - world.top) / cellSize));
+  column = std::max(0, std::min(column, columns - 1));
+  row = std::max(0, std::min(row, rows - 1));
+  return static_cast<uint32_t>(row * columns + column);
+}
+
+void SpatialGrid::insert(uint32_t id, const tgfx::Rect& bounds) {
+  if (id != slots.size()) {
+    return;
+  }
+  auto cell = getCell(bounds);
+  auto& objects = cells[cell];
+  slots.push_back({cell, static_cast<uint32_t>(objects.size())});
+  objects.push_back(id);
+}
+
+bool SpatialGrid::move(uint32_t id, const tgfx::Rect& bounds) {
+  auto& slot = slots[id];
+  auto cell = getCell(bounds);
+  if (cell == slot.cell) {
+    return false;
+  }
+  // Swap-remove the object from its old cell, then fix the index of the object swapped in.
+  auto& oldObjects = cells[slot.cell];
+  auto lastID = oldObjects.back();
+  oldObjects[slot.index] = lastID;
+  slots[lastID].index = slot.index;
+  oldObjects.pop_back();
+  auto& newObjects = cells[cell];
+  slot.cell = cell;
+  slot.index = static_cast<uint32_t>(newObjects.size());
+  newObjects.push_back(id);
+  return true;
+}
+
+void SpatialGrid::query(const tgfx::Rect& rect, float margin,
+                        std::vector<uint32_t>* results) const {
+  auto left = static_cast<int>(std::floor((rect.left - margin - world.left) / cellSize));
+  auto top = static_cast<int>(std::floor((rect.top - margin - world.top) / cellSize));
+  auto right = static_cast<int>(std::floor((rect.right + margin - world.left) / cellSize));
+  auto bottom = static_cast<int>(std::floor((rect.bottom + margin - world.top) / cellSize));
+  left = std::max(left, 0);
+  top = std::max(top, 0);
+  right = std::min(right, columns - 1);
+  bottom = std::min(bottom, rows - 1);
+  for (int row = top; row <= bottom; row++) {
+    for (int column = left; column <= right; column++) {
+      auto& objects = cells[static_cast<size_t>(row * columns + column)];
+      results->insert(results->end(), objects.begin(), objects.end());
+    }
+  }
+}
+}  // namespace benchmark
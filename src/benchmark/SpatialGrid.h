@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "tgfx/core/Rect.h"
+
+namespace benchmark {
+
+/**
+ * SpatialGrid is a uniform grid index over a fixed world rect. Each object is stored in the cell
+ * containing its center, and can be moved between cells incrementally in constant time.
+ */
+class SpatialGrid {
+ public:
+  /**
+   * Clears the grid and sets up cells of the given size covering the world rect.
+   */
+  void reset(const tgfx::Rect& worldRect, float cellSize);
+
+  /**
+   * Adds the object with the given id, which must be the number of objects added so far.
+   */
+  void insert(uint32_t id, const tgfx::Rect& bounds);
+
+  /**
+   * Updates the cell of the object with the given id after it has moved. Returns true if the object
+   * has changed cells.
+   */
+  bool move(uint32_t id, const tgfx::Rect& bounds);
+
+  /**
+   * Appends the ids of the objects whose centers lie in the cells overlapping the given rect,
+   * outset by the given margin. Callers pass half the size of their largest object as the margin,
+   * then test the bounds of each result.
+   */
+  void query(const tgfx::Rect& rect, float margin, std::vector<uint32_t>* results) const;
+
+  /**
+   * Returns the number of objects in the grid.
+   */
+  size_t count() const {
+    return slots.size();
+  }
+
+ private:
+  struct Slot {
+    uint32_t cell = 0;
+    uint32_t index = 0;
+  };
+
+  uint32_t getCell(const tgfx::Rect& bounds) const;
+
+  tgfx::Rect world = tgfx::Rect::MakeEmpty();
+  float cellSize = 1.f;
+  int columns = 0;
+  int rows = 0;
+  std::vector<std::vector<uint32_t>> cells = {};
+  // The cell of each object and its index in that cell.
+  std::vector<Slot> slots = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,209 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "StrokeBench.h"
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+namespace benchmark {
+static constexpr size_t MAX_PARTICLE_COUNT = 100000;
+static constexpr size_t MAX_POLYLINE_COUNT = 500;
+static constexpr size_t POLYLINE_POINTS = 2000;
+static constexpr size_t ZIGZAG_SEGMENTS = 4;
+static constexpr float POLYLINE_WIDTH = 1.5f;
+static constexpr float MITER_LIMITS[] = {1.f, 4.f, 10.f};
+static constexpr tgfx::LineCap LINE_CAPS[] = {tgfx::LineCap::Butt, tgfx::LineCap::Round,
+                                              tgfx::LineCap::Square};
+static constexpr tgfx::LineJoin LINE_JOINS[] = {tgfx::LineJoin::Miter, tgfx::LineJoin::Round,
+                                                tgfx::LineJoin::Bevel};
+
+static float StrokeWidth = 6.f;
+
+static std::string ToString(StrokeStyle style) {
+  switch (style) {
+    case StrokeStyle::Hairline:
+      return "Hairline";
+    case StrokeStyle::Thick:
+      return "Thick";
+    case StrokeStyle::Dash:
+      return "Dash";
+    case StrokeStyle::Polyline:
+      return "Polyline";
+    default:
+      return "Unknown";
+  }
+}
+
+// Creates a zigzag centered at the origin. Its corners are about 28 degrees, so a miter limit of 4
+// turns them into bevels while a miter limit of 10 keeps the miters.
+static tgfx::Path CreateZigzag(float size) {
+  tgfx::Path path;
+  auto step = size / static_cast<float>(ZIGZAG_SEGMENTS);
+  auto half = size * 0.5f;
+  path.moveTo(-half, half);
+  for (size_t i = 1; i <= ZIGZAG_SEGMENTS; i++) {
+    path.lineTo(-half + step * static_cast<float>(i), i % 2 == 1 ? -half : half);
+  }
+  return path;
+}
+
+// Creates a random walk spanning the given width, starting at y = 0.
+static tgfx::Path CreatePolyline(float width, float amplitude, std::mt19937* rng) {
+  std::uniform_real_distribution<float> distribution(-1, 1);
+  tgfx::Path path;
+  auto step = width / static_cast<float>(POLYLINE_POINTS - 1);
+  auto y = 0.f;
+  path.moveTo(0, y);
+  for (size_t i = 1; i < POLYLINE_POINTS; i++) {
+    y = std::max(-amplitude, std::min(y + distribution(*rng) * amplitude * 0.1f, amplitude));
+    path.lineTo(step * static_cast<float>(i), y);
+  }
+  return path;
+}
+
+StrokeBench::StrokeBench(StrokeStyle style)
+    : ParticleBench("StrokeBench-" + ToString(style), GraphicType::Rect), strokeStyle(style) {
+}
+
+void StrokeBench::SetStrokeWidth(float width) {
+  StrokeWidth = std::max(width, 0.f);
+}
+
+size_t StrokeBench::maxDrawCount() const {
+  auto limit = strokeStyle == StrokeStyle::Polyline ? MAX_POLYLINE_COUNT : MAX_PARTICLE_COUNT;
+  return std::min(ParticleBench::maxDrawCount(), limit);
+}
+
+size_t StrokeBench::increaseStep() const {
+  if (strokeStyle == StrokeStyle::Polyline) {
+    return 1;
+  }
+  return ParticleBench::increaseStep();
+}
+
+void StrokeBench::onInit(const AppHost* host) {
+  auto density = host->density();
+  switch (strokeStyle) {
+    case StrokeStyle::Hairline:
+      strokeWidth = 0;
+      break;
+    case StrokeStyle::Polyline:
+      strokeWidth = POLYLINE_WIDTH * density;
+      break;
+    default:
+      strokeWidth = StrokeWidth * density;
+      break;
+  }
+  strokePaints.clear();
+  for (auto cap : LINE_CAPS) {
+    for (auto join : LINE_JOINS) {
+      for (auto miterLimit : MITER_LIMITS) {
+        tgfx::Paint paint = paints[strokePaints.size() % 3];
+        paint.setStyle(tgfx::PaintStyle::Stroke);
+        paint.setStrokeWidth(strokeWidth);
+        paint.setLineCap(cap);
+        paint.setLineJoin(join);
+        paint.setMiterLimit(miterLimit);
+        strokePaints.push_back(paint);
+      }
+    }
+  }
+  auto maxCount = maxDrawCount();
+  strokePaths.resize(maxCount);
+  if (strokeStyle == StrokeStyle::Polyline) {
+    std::mt19937 pathRng(72);
+    for (auto& path : strokePaths) {
+      path = CreatePolyline(width, height * 0.1f, &pathRng);
+    }
+    segmentCount = POLYLINE_POINTS - 1;
+    return;
+  }
+  dashEffect = nullptr;
+  dashSegmentCounts.clear();
+  if (strokeStyle == StrokeStyle::Dash) {
+    float intervals[] = {2.f * strokeWidth, strokeWidth};
+    dashEffect = tgfx::PathEffect::MakeDash(intervals, 2, 0);
+  }
+  for (size_t i = 0; i < maxCount; i++) {
+    strokePaths[i] = CreateZigzag(graphics[i].rect.width() * 1.5f);
+  }
+  segmentCount = ZIGZAG_SEGMENTS;
+  if (dashEffect == nullptr) {
+    return;
+  }
+  // The zigzags are dashed again in every frame, this only counts the line pieces they end up with.
+  dashSegmentCounts.resize(maxCount);
+  for (size_t i = 0; i < maxCount; i++) {
+    auto path = strokePaths[i];
+    dashEffect->filterPath(&path);
+    uint32_t count = 0;
+    path.decompose([&](tgfx::PathVerb verb, const tgfx::Point*, void*) {
+      if (verb == tgfx::PathVerb::Line) {
+        count++;
+      }
+    });
+    dashSegmentCounts[i] = count;
+  }
+}
+
+void StrokeBench::onAnimate(const AppHost* host) {
+  ParticleBench::onAnimate(host);
+  if (strokeStyle != StrokeStyle::Polyline) {
+    return;
+  }
+  // Polylines span the whole screen width, only their vertical positions follow the particles.
+  for (size_t i = 0; i < drawCount; i++) {
+    auto& rect = graphics[i].rect;
+    rect.offsetTo(0, rect.top);
+  }
+}
+
+void StrokeBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  for (size_t i = 0; i < drawCount; i++) {
+    auto& rect = graphics[i].rect;
+    auto x = strokeStyle == StrokeStyle::Polyline ? 0.f : rect.centerX();
+    canvas->setMatrix(tgfx::Matrix::MakeTrans(x, rect.centerY()));
+    auto& paint = strokePaints[i % strokePaints.size()];
+    if (dashEffect != nullptr) {
+      // Dash every frame, so that the cost of the path effect is part of what is measured.
+      dashedPath = strokePaths[i];
+      dashEffect->filterPath(&dashedPath);
+      canvas->drawPath(dashedPath, paint);
+    } else {
+      canvas->drawPath(strokePaths[i], paint);
+    }
+  }
+  canvas->resetMatrix();
+  canvas->drawRect(startRect, {});
+}
+
+void StrokeBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  std::ostringstream widthStream;
+  widthStream << "Width: " << std::fixed << std::setprecision(1) << strokeWidth;
+  lines->push_back(widthStream.str());
+  size_t segments = drawCount * segmentCount;
+  if (!dashSegmentCounts.empty()) {
+    segments = 0;
+    for (size_t i = 0; i < drawCount; i++) {
+      segments += dashSegmentCounts[i];
+    }
+  }
+  lines->push_back("Segments: " + std::to_string(segments));
+}
+}  // namespace benchmark
@@ -0,0 +1,69 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+#include "tgfx/core/PathEffect.h"
+
+namespace benchmark {
+
+enum class StrokeStyle { Hairline, Thick, Dash, Polyline };
+
+/**
+ * StrokeBench draws stroked open paths to measure stroke tessellation. The particles are zigzags
+ * with sharp corners, cycling through all line caps, line joins and a few miter limits. The
+ * Hairline style uses zero-width strokes, the Thick style uses the width set by SetStrokeWidth(),
+ * and the Dash style applies a dash path effect to the thick zigzags in every frame. The Polyline
+ * style replaces the particles with long chart-like polylines spanning the screen width.
+ */
+class StrokeBench : public ParticleBench {
+ public:
+  explicit StrokeBench(StrokeStyle style);
+
+  /**
+   * Sets the stroke width in points used by the Thick and Dash styles. The default value is 6.
+   */
+  static void SetStrokeWidth(float width);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+  size_t increaseStep() const override;
+
+ private:
+  StrokeStyle strokeStyle = StrokeStyle::Hairline;
+  float strokeWidth = 0;
+  size_t segmentCount = 0;
+  std::vector<tgfx::Path> strokePaths = {};
+  std::vector<tgfx::Paint> strokePaints = {};
+  std::shared_ptr<tgfx::PathEffect> dashEffect = nullptr;
+  // The number of line pieces of each dashed zigzag.
+  std::vector<uint32_t> dashSegmentCounts = {};
+  tgfx::Path dashedPath = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ThumbnailBench.h"
+#include <iomanip>
+#include <sstream>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Surface.h"
+
+namespace benchmark {
+static constexpr size_t MAX_THUMBNAIL_COUNT = 2000;
+static constexpr size_t THUMBNAIL_STEP = 10;
+static constexpr int THUMBNAIL_SIZES[] = {64, 96, 128, 160, 256};
+static constexpr size_t SIZE_COUNT = sizeof(THUMBNAIL_SIZES) / sizeof(THUMBNAIL_SIZES[0]);
+static constexpr int64_t RATE_INTERVAL = 1000000;
+
+static std::string ToString(SurfaceMode mode) {
+  switch (mode) {
+    case SurfaceMode::Fresh:
+      return "Fresh";
+    case SurfaceMode::Pooled:
+      return "Pooled";
+    default:
+      return "Unknown";
+  }
+}
+
+static uint64_t SizeKey(int width, int height) {
+  return static_cast<uint64_t>(width) << 32 | static_cast<uint32_t>(height);
+}
+
+ThumbnailBench::ThumbnailBench(SurfaceMode mode)
+    : ParticleBench("ThumbnailBench-" + ToString(mode), GraphicType::RRect), surfaceMode(mode) {
+}
+
+size_t ThumbnailBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), MAX_THUMBNAIL_COUNT);
+}
+
+size_t ThumbnailBench::increaseStep() const {
+  return std::min(ParticleBench::increaseStep(), THUMBNAIL_STEP);
+}
+
+void ThumbnailBench::onInit(const AppHost* host) {
+  image = host->getImage("bridge");
+  surfacePool.clear();
+  auto maxSize = static_cast<size_t>(THUMBNAIL_SIZES[SIZE_COUNT - 1]);
+  pixels.resize(maxSize * maxSize * 4);
+  lastThumbnail = nullptr;
+  frameIndex = 0;
+  rateStartTime = tgfx::Clock::Now();
+  renderedCount = 0;
+  createdCount = 0;
+  renderedPerSecond = 0;
+  createdPerSecond = 0;
+}
+
+void ThumbnailBench::onAnimate(const AppHost*) {
+  frameIndex++;
+}
+
+std::shared_ptr<tgfx::Surface> ThumbnailBench::obtainSurface(tgfx::Context* context, int width,
+                                                             int height) {
+  if (surfaceMode == SurfaceMode::Pooled) {
+    auto& surfaces = surfacePool[SizeKey(width, height)];
+    if (!surfaces.empty()) {
+      auto surface = std::move(surfaces.back());
+      surfaces.pop_back();
+      return surface;
+    }
+  }
+  createdCount++;
+  return tgfx::Surface::Make(context, width, height);
+}
+
+void ThumbnailBench::releaseSurface(std::shared_ptr<tgfx::Surface> surface) {
+  if (surfaceMode == SurfaceMode::Pooled) {
+    surfacePool[SizeKey(surface->width(), surface->height())].push_back(std::move(surface));
+  }
+}
+
+void ThumbnailBench::drawThumbnail(tgfx::Canvas* canvas, size_t index, int width,
+                                   int height) const {
+  auto bounds = tgfx::Rect::MakeWH(width, height);
+  canvas->clear(tgfx::Color::White());
+  if (image != nullptr) {
+    // Center-crops the image to the thumbnail aspect ratio.
+    auto scale = std::max(bounds.width() / static_cast<float>(image->width()),
+                          bounds.height() / static_cast<float>(image->height()));
+    auto imageWidth = static_cast<float>(image->width()) * scale;
+    auto imageHeight = static_cast<float>(image->height()) * scale;
+    auto imageRect = tgfx::Rect::MakeXYWH((bounds.width() - imageWidth) * 0.5f,
+                                          (bounds.height() - imageHeight) * 0.5f, imageWidth,
+                                          imageHeight);
+    canvas->drawImageRect(image, imageRect, tgfx::SamplingOptions(tgfx::FilterMode::Linear));
+  }
+  auto badgeSize = bounds.height() * 0.25f;
+  auto badge = tgfx::Rect::MakeXYWH(bounds.width() - badgeSize * 1.25f, badgeSize * 0.25f,
+                                    badgeSize, badgeSize);
+  canvas->drawRoundRect(badge, badgeSize * 0.3f, badgeSize * 0.3f, paints[index % 3]);
+}
+
+void ThumbnailBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost*) {
+  auto windowSurface = canvas->getSurface();
+  if (windowSurface == nullptr || windowSurface->getContext() == nullptr) {
+    return;
+  }
+  auto context = windowSurface->getContext();
+  for (size_t i = 0; i < drawCount; i++) {
+    // Varies the width and height independently, so there are SIZE_COUNT squared size classes.
+    auto seed = i + static_cast<size_t>(frameIndex);
+    auto thumbnailWidth = THUMBNAIL_SIZES[seed % SIZE_COUNT];
+    auto thumbnailHeight = THUMBNAIL_SIZES[seed / SIZE_COUNT % SIZE_COUNT];
+    auto surface = obtainSurface(context, thumbnailWidth, thumbnailHeight);
+    if (surface == nullptr) {
+      continue;
+    }
+    drawThumbnail(surface->getCanvas(), i, thumbnailWidth, thumbnailHeight);
+    auto info = tgfx::ImageInfo::Make(thumbnailWidth, thumbnailHeight, tgfx::ColorType::RGBA_8888);
+    if (surface->readPixels(info, pixels.data()) && i + 1 == drawCount) {
+      lastThumbnail = tgfx::Image::MakeFrom(info, tgfx::Data::MakeWithCopy(pixels.data(),
+                                                                           info.byteSize()));
+    }
+    releaseSurface(std::move(surface));
+    renderedCount++;
+  }
+  memoryUsage = context->memoryUsage();
+  purgeableBytes = context->purgeableBytes();
+  if (lastThumbnail != nullptr) {
+    auto left = (width - static_cast<float>(lastThumbnail->width())) * 0.5f;
+    auto top = (height - static_cast<float>(lastThumbnail->height())) * 0.5f;
+    canvas->drawImage(lastThumbnail, left, top);
+  }
+  auto currentTime = tgfx::Clock::Now();
+  if (currentTime - rateStartTime >= RATE_INTERVAL) {
+    auto seconds = static_cast<float>(currentTime - rateStartTime) / 1000000.f;
+    renderedPerSecond = static_cast<float>(renderedCount) / seconds;
+    createdPerSecond = static_cast<float>(createdCount) / seconds;
+    renderedCount = 0;
+    createdCount = 0;
+    rateStartTime = currentTime;
+  }
+}
+
+void ThumbnailBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(0) << renderedPerSecond;
+  lines->push_back("Surfaces: " + oss.str() + "/s");
+  oss.str("");
+  oss << std::fixed << std::setprecision(0) << createdPerSecond;
+  lines->push_back("Created: " + oss.str() + "/s");
+  oss.str("");
+  oss << std::fixed << std::setprecision(1) << static_cast<double>(memoryUsage) / 1048576.0;
+  lines->push_back("Mem: " + oss.str() + "MB");
+  oss.str("");
+  oss << std::fixed << std::setprecision(1) << static_cast<double>(purgeableBytes) / 1048576.0;
+  lines->push_back("Purgeable: " + oss.str() + "MB");
+}
+}  // namespace benchmark
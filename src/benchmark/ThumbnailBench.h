@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <unordered_map>
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+enum class SurfaceMode { Fresh, Pooled };
+
+/**
+ * ThumbnailBench renders a batch of small thumbnails of varied sizes every frame, each one into
+ * its own offscreen surface that is drawn, read back and then released. Each particle is one
+ * thumbnail. The Fresh mode creates a new surface for every thumbnail and lets the resource cache
+ * deal with the churn, while the Pooled mode keeps released surfaces by size and reuses them.
+ */
+class ThumbnailBench : public ParticleBench {
+ public:
+  explicit ThumbnailBench(SurfaceMode mode);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+  size_t increaseStep() const override;
+
+ private:
+  std::shared_ptr<tgfx::Surface> obtainSurface(tgfx::Context* context, int width, int height);
+
+  void releaseSurface(std::shared_ptr<tgfx::Surface> surface);
+
+  void drawThumbnail(tgfx::Canvas* canvas, size_t index, int width, int height) const;
+
+  SurfaceMode surfaceMode = SurfaceMode::Fresh;
+  std::shared_ptr<tgfx::Image> image = nullptr;
+  // Released surfaces by size, the key is the width in the high 32 bits and the height below.
+  std::unordered_map<uint64_t, std::vector<std::shared_ptr<tgfx::Surface>>> surfacePool = {};
+  std::vector<uint8_t> pixels = {};
+  std::shared_ptr<tgfx::Image> lastThumbnail = nullptr;
+  int64_t frameIndex = 0;
+  int64_t rateStartTime = 0;
+  size_t renderedCount = 0;
+  size_t createdCount = 0;
+  float renderedPerSecond = 0;
+  float createdPerSecond = 0;
+  size_t memoryUsage = 0;
+  size_t purgeableBytes = 0;
+};
+
+}  // namespace benchmark
@@ -0,0 +1,224 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UISceneBench.h"
+#include <cmath>
+#include <random>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/ImageFilter.h"
+#include "tgfx/core/PictureRecorder.h"
+
+namespace benchmark {
+static constexpr size_t MAX_CARD_COUNT = 50000;
+static constexpr float CARD_WIDTH = 160.f;
+static constexpr float CARD_HEIGHT = 100.f;
+static constexpr float CARD_MARGIN = 8.f;
+static constexpr float SCROLL_SPEED = 1.f;
+static constexpr int LIST_ROWS = 6;
+static constexpr int64_t ATTRIBUTION_INTERVAL = 60;
+static constexpr uint8_t ALL_ELEMENTS = 0xFF;
+
+static float ElementFractions[] = {1.f, 0.3f, 0.5f, 1.f, 0.5f, 0.2f};
+
+static tgfx::Path CreateHeart(float size) {
+  tgfx::Path path;
+  auto half = size * 0.5f;
+  path.moveTo(half, size);
+  path.cubicTo(-size * 0.2f, size * 0.45f, size * 0.1f, -size * 0.15f, half, size * 0.25f);
+  path.cubicTo(size * 0.9f, -size * 0.15f, size * 1.2f, size * 0.45f, half, size);
+  path.close();
+  return path;
+}
+
+UISceneBench::UISceneBench() : ParticleBench("UISceneBench", GraphicType::RRect) {
+}
+
+void UISceneBench::SetElementFractions(float shadow, float image, float label, float icon,
+                                       float list) {
+  float fractions[] = {shadow, image, label, icon, list};
+  for (int i = 0; i < 5; i++) {
+    ElementFractions[i + 1] = std::max(0.f, std::min(fractions[i], 1.f));
+  }
+}
+
+size_t UISceneBench::maxDrawCount() const {
+  return std::min(ParticleBench::maxDrawCount(), MAX_CARD_COUNT);
+}
+
+void UISceneBench::onInit(const AppHost* host) {
+  auto density = host->density();
+  cardWidth = CARD_WIDTH * density;
+  cardHeight = CARD_HEIGHT * density;
+  auto maxCount = maxDrawCount();
+  cardElements.resize(maxCount);
+  std::mt19937 elementRng(108);
+  std::uniform_real_distribution<float> distribution(0, 1);
+  for (auto& elements : cardElements) {
+    elements = 0;
+    for (int element = Background; element < ElementCount; element++) {
+      if (distribution(elementRng) < ElementFractions[element]) {
+        elements |= static_cast<uint8_t>(1 << element);
+      }
+    }
+  }
+  labels.clear();
+  for (int i = 0; i < 100; i++) {
+    labels.push_back("Card " + std::to_string(i));
+  }
+  labelFont = tgfx::Font(host->getTypeface("default"), 14.f * density);
+  rowFont = tgfx::Font(host->getTypeface("default"), 9.f * density);
+  iconPath = CreateHeart(18.f * density);
+  image = host->getImage("bridge");
+  if (image != nullptr) {
+    image = image->makeMipmapped(true);
+  }
+  backgroundPaint = {};
+  backgroundPaint.setColor(tgfx::Color::White());
+  shadowPaint = backgroundPaint;
+  shadowPaint.setImageFilter(tgfx::ImageFilter::DropShadowOnly(
+      0, 2.f * density, 4.f * density, 4.f * density, tgfx::Color{0.f, 0.f, 0.f, 0.3f}));
+  textPaint = {};
+  textPaint.setColor(tgfx::Color{0.13f, 0.13f, 0.13f, 1.f});
+  rowPaints[0].setColor(tgfx::Color{0.95f, 0.95f, 0.97f, 1.f});
+  rowPaints[1].setColor(tgfx::Color{0.88f, 0.9f, 0.95f, 1.f});
+  scrollOffset = 0;
+  frameIndex = 0;
+  for (auto& time : elementTimes) {
+    time = 0;
+  }
+}
+
+void UISceneBench::onAnimate(const AppHost* host) {
+  scrollOffset += SCROLL_SPEED * host->density();
+  frameIndex++;
+  // Lay the cards out in a grid scrolling upwards. Cards that do not fit in one screen are stacked
+  // on the earlier ones with a small shift, so that every card stays visible.
+  auto columns = std::max(static_cast<size_t>(width / cardWidth), static_cast<size_t>(1));
+  auto rows = static_cast<size_t>(std::ceil(height / cardHeight)) + 1;
+  auto cardsPerScreen = columns * rows;
+  auto scrollHeight = static_cast<float>(rows) * cardHeight;
+  for (size_t i = 0; i < drawCount; i++) {
+    auto slot = i % cardsPerScreen;
+    auto stack = static_cast<float>(i / cardsPerScreen % 8);
+    auto x = static_cast<float>(slot % columns) * cardWidth + stack * 3.f;
+    auto y = static_cast<float>(slot / columns) * cardHeight + stack * 3.f - scrollOffset;
+    y = std::fmod(y, scrollHeight);
+    if (y < -cardHeight) {
+      y += scrollHeight;
+    }
+    graphics[i].rect.setXYWH(x, y, cardWidth, cardHeight);
+  }
+}
+
+void UISceneBench::drawCard(tgfx::Canvas* canvas, size_t index, uint8_t elementMask) const {
+  auto elements = cardElements[index];
+  auto drawn = elements & elementMask;
+  auto rect = graphics[index].rect;
+  rect.inset(CARD_MARGIN, CARD_MARGIN);
+  auto radius = rect.height() * 0.1f;
+  auto padding = rect.height() * 0.08f;
+  if (drawn & (1 << Shadow)) {
+    canvas->drawRoundRect(rect, radius, radius, shadowPaint);
+  }
+  if (drawn & (1 << Background)) {
+    canvas->drawRoundRect(rect, radius, radius, backgroundPaint);
+  }
+  // The layout depends on the elements of the card, not on those drawn in this pass.
+  auto contentLeft = rect.left + padding;
+  if ((elements & (1 << Picture)) && image != nullptr) {
+    auto side = rect.height() - padding * 2;
+    auto imageRect = tgfx::Rect::MakeXYWH(contentLeft, rect.top + padding, side, side);
+    if (drawn & (1 << Picture)) {
+      canvas->drawImageRect(image, imageRect);
+    }
+    contentLeft = imageRect.right + padding;
+  }
+  if (drawn & (1 << Label)) {
+    canvas->drawSimpleText(labels[index % labels.size()], contentLeft,
+                           rect.top + padding + labelFont.getSize(), labelFont, textPaint);
+  }
+  if (drawn & (1 << Icon)) {
+    canvas->save();
+    auto iconBounds = iconPath.getBounds();
+    canvas->translate(rect.right - padding - iconBounds.width(), rect.top + padding);
+    canvas->drawPath(iconPath, paints[index % 3]);
+    canvas->restore();
+  }
+  if (drawn & (1 << List)) {
+    auto listRect = tgfx::Rect::MakeLTRB(contentLeft, rect.top + padding * 2 + labelFont.getSize(),
+                                         rect.right - padding, rect.bottom - padding);
+    auto rowHeight = listRect.height() / (LIST_ROWS - 1);
+    // Rows scroll inside the list, so the first and last ones are cut by the clip.
+    auto rowOffset = std::fmod(static_cast<float>(frameIndex + static_cast<int64_t>(index)) * 0.5f,
+                               rowHeight);
+    canvas->save();
+    canvas->clipRect(listRect);
+    for (int row = 0; row < LIST_ROWS; row++) {
+      auto top = listRect.top + static_cast<float>(row) * rowHeight - rowOffset;
+      auto rowRect = tgfx::Rect::MakeXYWH(listRect.left, top, listRect.width(), rowHeight);
+      canvas->drawRect(rowRect, rowPaints[row % 2]);
+      canvas->drawSimpleText(labels[static_cast<size_t>(row)], rowRect.left + padding,
+                             rowRect.bottom - rowHeight * 0.25f, rowFont, textPaint);
+    }
+    canvas->restore();
+  }
+}
+
+void UISceneBench::measureElements(const AppHost* host) {
+  // Records every element type of all cards into its own picture, which is never drawn. The pass
+  // is left out of the frame time, so it does not slow down the draw count ramp.
+  auto startTime = tgfx::Clock::Now();
+  for (int element = Background; element < ElementCount; element++) {
+    auto elementStartTime = tgfx::Clock::Now();
+    tgfx::PictureRecorder recorder = {};
+    auto canvas = recorder.beginRecording();
+    for (size_t i = 0; i < drawCount; i++) {
+      drawCard(canvas, i, static_cast<uint8_t>(1 << element));
+    }
+    recorder.finishRecordingAsPicture();
+    elementTimes[element] = tgfx::Clock::Now() - elementStartTime;
+  }
+  host->excludeTime(tgfx::Clock::Now() - startTime);
+}
+
+void UISceneBench::onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) {
+  for (size_t i = 0; i < drawCount; i++) {
+    drawCard(canvas, i, ALL_ELEMENTS);
+  }
+  if (frameIndex % ATTRIBUTION_INTERVAL == 0) {
+    measureElements(host);
+  }
+}
+
+void UISceneBench::onUpdateStatus(const AppHost*, std::vector<std::string>* lines) {
+  static const char* elementNames[] = {"Card", "Shadow", "Image", "Label", "Icon", "List"};
+  int64_t totalTime = 0;
+  for (auto time : elementTimes) {
+    totalTime += time;
+  }
+  if (totalTime <= 0) {
+    return;
+  }
+  // Shares of the recording time only, the flush and the GPU work are not attributed.
+  for (int element = Background; element < ElementCount; element++) {
+    auto percent = elementTimes[element] * 100 / totalTime;
+    lines->push_back(std::string(elementNames[element]) + " rec: " + std::to_string(percent) +
+                     "%");
+  }
+}
+}  // namespace benchmark
@@ -0,0 +1,79 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ParticleBench.h"
+
+namespace benchmark {
+
+/**
+ * UISceneBench draws a synthetic app UI made of cards that scroll slowly. Each card has a rounded
+ * background and, in configurable proportions, a drop shadow, an image, a text label, a path icon
+ * and a clipped list. Each particle is one card. Every ATTRIBUTION_INTERVAL frames, the elements of
+ * each type are recorded again into a separate picture, and the status bar shows the share of the
+ * recording time taken by each type. That pass is left out of the frame time, and the flush and
+ * GPU costs are not attributed.
+ */
+class UISceneBench : public ParticleBench {
+ public:
+  UISceneBench();
+
+  /**
+   * Sets the fraction of cards having each optional element, in the range [0, 1]. The default
+   * values are 0.3 for shadows, 0.5 for images, 1.0 for labels, 0.5 for icons and 0.2 for lists.
+   */
+  static void SetElementFractions(float shadow, float image, float label, float icon, float list);
+
+ protected:
+  void onInit(const AppHost* host) override;
+
+  void onAnimate(const AppHost* host) override;
+
+  void onDrawGraphics(tgfx::Canvas* canvas, const AppHost* host) override;
+
+  void onUpdateStatus(const AppHost* host, std::vector<std::string>* lines) override;
+
+  size_t maxDrawCount() const override;
+
+ private:
+  enum Element { Background, Shadow, Picture, Label, Icon, List, ElementCount };
+
+  void drawCard(tgfx::Canvas* canvas, size_t index, uint8_t elementMask) const;
+
+  void measureElements(const AppHost* host);
+
+  float cardWidth = 0;
+  float cardHeight = 0;
+  float scrollOffset = 0;
+  int64_t frameIndex = 0;
+  // The elements of each card, as bits shifted by the Element values.
+  std::vector<uint8_t> cardElements = {};
+  std::vector<std::string> labels = {};
+  tgfx::Font labelFont = {};
+  tgfx::Font rowFont = {};
+  tgfx::Path iconPath = {};
+  std::shared_ptr<tgfx::Image> image = nullptr;
+  tgfx::Paint backgroundPaint = {};
+  tgfx::Paint shadowPaint = {};
+  tgfx::Paint textPaint = {};
+  tgfx::Paint rowPaints[2];
+  int64_t elementTimes[ElementCount] = {};
+};
+
+}  // namespace benchmark
@@ -0,0 +1,233 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "YUVConverter.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BENCHMARK_YUV_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define BENCHMARK_YUV_NEON
+#include <arm_neon.h>
+#endif
+
+namespace benchmark {
+// The SIMD paths convert 16 pixels of two rows per iteration.
+static constexpr int BLOCK_WIDTH = 16;
+
+size_t YUVByteSize(int width, int height) {
+  auto pixelCount = static_cast<size_t>(width) * static_cast<size_t>(height);
+  return pixelCount + pixelCount / 2;
+}
+
+static inline uint8_t Luma(int r, int g, int b) {
+  return static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+}
+
+static inline uint8_t ChromaU(int r, int g, int b) {
+  return static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+}
+
+static inline uint8_t ChromaV(int r, int g, int b) {
+  return static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+}
+
+// Converts the pixels from startX to width of two rows. The chroma step is 1 for I420 and 2 for
+// NV12, where the U and V samples are interleaved.
+static void ConvertRowPairScalar(const uint8_t* row0, const uint8_t* row1, int startX, int width,
+                                 uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v,
+                                 int chromaStep) {
+  for (int x = startX; x < width; x += 2) {
+    auto p0 = row0 + x * 4;
+    auto p1 = row1 + x * 4;
+    auto r = p0[0] + p0[4] + p1[0] + p1[4];
+    auto g = p0[1] + p0[5] + p1[1] + p1[5];
+    auto b = p0[2] + p0[6] + p1[2] + p1[6];
+    y0[x] = Luma(row0[x * 4], row0[x * 4 + 1], row0[x * 4 + 2]);
+    y0[x + 1] = Luma(row0[x * 4 + 4], row0[x * 4 + 5], row0[x * 4 + 6]);
+    y1[x] = Luma(row1[x * 4], row1[x * 4 + 1], row1[x * 4 + 2]);
+    y1[x + 1] = Luma(row1[x * 4 + 4], row1[x * 4 + 5], row1[x * 4 + 6]);
+    r = (r + 2) >> 2;
+    g = (g + 2) >> 2;
+    b = (b + 2) >> 2;
+    auto index = x / 2 * chromaStep;
+    u[index] = ChromaU(r, g, b);
+    v[index] = ChromaV(r, g, b);
+  }
+}
+
+#if defined(BENCHMARK_YUV_SSE2)
+
+// Deinterleaves 8 RGBA pixels into 16-bit R, G and B lanes.
+static inline void LoadChannels(const uint8_t* pixels, __m128i* r, __m128i* g, __m128i* b) {
+  auto mask = _mm_set1_epi32(0xFF);
+  auto p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+  auto p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + 16));
+  *r = _mm_packs_epi32(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask));
+  *g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), mask),
+                       _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+  *b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), mask),
+                       _mm_and_si128(_mm_srli_epi32(p1, 16), mask));
+}
+
+// The weighted sum stays below 65536, so it is computed in unsigned 16-bit lanes.
+static inline __m128i LumaSSE2(__m128i r, __m128i g, __m128i b) {
+  auto sum = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(66)),
+                           _mm_mullo_epi16(g, _mm_set1_epi16(129)));
+  sum = _mm_add_epi16(sum, _mm_mullo_epi16(b, _mm_set1_epi16(25)));
+  sum = _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(128)), 8);
+  return _mm_add_epi16(sum, _mm_set1_epi16(16));
+}
+
+// The weighted sums stay within [-32768, 32767], so they are computed in signed 16-bit lanes.
+static inline __m128i ChromaSSE2(__m128i r, __m128i g, __m128i b, short cr, short cg, short cb) {
+  auto sum = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(cr)),
+                           _mm_mullo_epi16(g, _mm_set1_epi16(cg)));
+  sum = _mm_add_epi16(sum, _mm_mullo_epi16(b, _mm_set1_epi16(cb)));
+  sum = _mm_srai_epi16(_mm_add_epi16(sum, _mm_set1_epi16(128)), 8);
+  return _mm_add_epi16(sum, _mm_set1_epi16(128));
+}
+
+// Averages the 2x2 blocks of 16 pixels given as two rows of two 8-lane halves.
+static inline __m128i Average2x2(__m128i a0, __m128i a1, __m128i b0, __m128i b1) {
+  auto ones = _mm_set1_epi16(1);
+  auto sum0 = _mm_madd_epi16(_mm_add_epi16(a0, b0), ones);
+  auto sum1 = _mm_madd_epi16(_mm_add_epi16(a1, b1), ones);
+  auto sum = _mm_packs_epi32(sum0, sum1);
+  return _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(2)), 2);
+}
+
+static int ConvertRowPairSIMD(const uint8_t* row0, const uint8_t* row1, int width, uint8_t* y0,
+                              uint8_t* y1, uint8_t* u, uint8_t* v, YUVFormat format) {
+  int x = 0;
+  for (; x + BLOCK_WIDTH <= width; x += BLOCK_WIDTH) {
+    __m128i r[4], g[4], b[4];
+    LoadChannels(row0 + x * 4, &r[0], &g[0], &b[0]);
+    LoadChannels(row0 + x * 4 + 32, &r[1], &g[1], &b[1]);
+    LoadChannels(row1 + x * 4, &r[2], &g[2], &b[2]);
+    LoadChannels(row1 + x * 4 + 32, &r[3], &g[3], &b[3]);
+    auto luma0 = _mm_packus_epi16(LumaSSE2(r[0], g[0], b[0]), LumaSSE2(r[1], g[1], b[1]));
+    auto luma1 = _mm_packus_epi16(LumaSSE2(r[2], g[2], b[2]), LumaSSE2(r[3], g[3], b[3]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(y0 + x), luma0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(y1 + x), luma1);
+    auto red = Average2x2(r[0], r[1], r[2], r[3]);
+    auto green = Average2x2(g[0], g[1], g[2], g[3]);
+    auto blue = Average2x2(b[0], b[1], b[2], b[3]);
+    auto chromaU = ChromaSSE2(red, green, blue, -38, -74, 112);
+    auto chromaV = ChromaSSE2(red, green, blue, 112, -94, -18);
+    auto packed = _mm_packus_epi16(chromaU, chromaV);
+    if (format == YUVFormat::I420) {
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(u + x / 2), packed);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(v + x / 2), _mm_srli_si128(packed, 8));
+    } else {
+      auto interleaved = _mm_unpacklo_epi8(packed, _mm_srli_si128(packed, 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(u + x), interleaved);
+    }
+  }
+  return x;
+}
+
+#elif defined(BENCHMARK_YUV_NEON)
+
+static inline uint8x8_t LumaNEON(uint8x8_t r, uint8x8_t g, uint8x8_t b) {
+  auto sum = vmull_u8(r, vdup_n_u8(66));
+  sum = vmlal_u8(sum, g, vdup_n_u8(129));
+  sum = vmlal_u8(sum, b, vdup_n_u8(25));
+  return vadd_u8(vrshrn_n_u16(sum, 8), vdup_n_u8(16));
+}
+
+static inline uint8x8_t ChromaNEON(int16x8_t r, int16x8_t g, int16x8_t b, int16_t cr,
+                                   int16_t cg, int16_t cb) {
+  auto sum = vmulq_n_s16(r, cr);
+  sum = vmlaq_n_s16(sum, g, cg);
+  sum = vmlaq_n_s16(sum, b, cb);
+  return vqmovun_s16(vaddq_s16(vrshrq_n_s16(sum, 8), vdupq_n_s16(128)));
+}
+
+// Averages the 2x2 blocks of 16 pixels of two rows.
+static inline int16x8_t Average2x2(uint8x16_t a, uint8x16_t b) {
+  auto sum = vaddq_u16(vpaddlq_u8(a), vpaddlq_u8(b));
+  return vreinterpretq_s16_u16(vrshrq_n_u16(sum, 2));
+}
+
+static int ConvertRowPairSIMD(const uint8_t* row0, const uint8_t* row1, int width, uint8_t* y0,
+                              uint8_t* y1, uint8_t* u, uint8_t* v, YUVFormat format) {
+  int x = 0;
+  for (; x + BLOCK_WIDTH <= width; x += BLOCK_WIDTH) {
+    auto p0 = vld4q_u8(row0 + x * 4);
+    auto p1 = vld4q_u8(row1 + x * 4);
+    auto luma0 = vcombine_u8(
+        LumaNEON(vget_low_u8(p0.val[0]), vget_low_u8(p0.val[1]), vget_low_u8(p0.val[2])),
+        LumaNEON(vget_high_u8(p0.val[0]), vget_high_u8(p0.val[1]), vget_high_u8(p0.val[2])));
+    auto luma1 = vcombine_u8(
+        LumaNEON(vget_low_u8(p1.val[0]), vget_low_u8(p1.val[1]), vget_low_u8(p1.val[2])),
+        LumaNEON(vget_high_u8(p1.val[0]), vget_high_u8(p1.val[1]), vget_high_u8(p1.val[2])));
+    vst1q_u8(y0 + x, luma0);
+    vst1q_u8(y1 + x, luma1);
+    auto red = Average2x2(p0.val[0], p1.val[0]);
+    auto green = Average2x2(p0.val[1], p1.val[1]);
+    auto blue = Average2x2(p0.val[2], p1.val[2]);
+    auto chromaU = ChromaNEON(red, green, blue, -38, -74, 112);
+    auto chromaV = ChromaNEON(red, green, blue, 112, -94, -18);
+    if (format == YUVFormat::I420) {
+      vst1_u8(u + x / 2, chromaU);
+      vst1_u8(v + x / 2, chromaV);
+    } else {
+      uint8x8x2_t interleaved = {{chromaU, chromaV}};
+      vst2_u8(u + x, interleaved);
+    }
+  }
+  return x;
+}
+
+#else
+
+static int ConvertRowPairSIMD(const uint8_t*, const uint8_t*, int, uint8_t*, uint8_t*, uint8_t*,
+                              uint8_t*, YUVFormat) {
+  return 0;
+}
+
+#endif
+
+void ConvertRGBAToYUV(const uint8_t* rgba, size_t rowBytes, int width, int height,
+                      YUVFormat format, uint8_t* yuv) {
+  auto lumaSize = static_cast<size_t>(width) * static_cast<size_t>(height);
+  auto chromaWidth = static_cast<size_t>(width / 2);
+  auto chromaPlane = yuv + lumaSize;
+  for (int row = 0; row + 1 < height; row += 2) {
+    auto row0 = rgba + static_cast<size_t>(row) * rowBytes;
+    auto row1 = row0 + rowBytes;
+    auto y0 = yuv + static_cast<size_t>(row) * static_cast<size_t>(width);
+    auto y1 = y0 + width;
+    auto chromaRow = static_cast<size_t>(row / 2);
+    uint8_t* u = nullptr;
+    uint8_t* v = nullptr;
+    int chromaStep = 1;
+    if (format == YUVFormat::I420) {
+      u = chromaPlane + chromaRow * chromaWidth;
+      v = chromaPlane + lumaSize / 4 + chromaRow * chromaWidth;
+    } else {
+      u = chromaPlane + chromaRow * chromaWidth * 2;
+      v = u + 1;
+      chromaStep = 2;
+    }
+    auto x = ConvertRowPairSIMD(row0, row1, width, y0, y1, u, v, format);
+    ConvertRowPairScalar(row0, row1, x, width, y0, y1, u, v, chromaStep);
+  }
+}
+}  // namespace benchmark
@@ -0,0 +1,42 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace benchmark {
+
+enum class YUVFormat { I420, NV12 };
+
+/**
+ * Returns the number of bytes of a YUV 4:2:0 image with the given size.
+ */
+size_t YUVByteSize(int width, int height);
+
+/**
+ * Converts RGBA pixels to BT.601 limited-range YUV 4:2:0. The Y plane is followed by the U and V
+ * planes for I420, or by one interleaved UV plane for NV12. Each chroma sample is the average of
+ * a 2x2 pixel block, so the width and height must be even. Uses SSE2 or NEON where available and
+ * falls back to scalar code elsewhere, all producing the same output.
+ */
+void ConvertRGBAToYUV(const uint8_t* rgba, size_t rowBytes, int width, int height,
+                      YUVFormat format, uint8_t* yuv);
+
+}  // namespace benchmark
@@ -22,6 +22,9 @@
 #include <filesystem>
 #include "base/AppHost.h"
 #include "base/Bench.h"
+#include "base/FramePipeline.h"
+#include "base/MemoryTracker.h"
+#include "base/SoakRunner.h"
 #include "tgfx/core/Canvas.h"
 #include "tgfx/core/Clock.h"
 #include "tgfx/core/Surface.h"
@@ -36,7 +39,9 @@
   NSView* view;
   std::shared_ptr<tgfx::CGLWindow> cglWindow;
   std::unique_ptr<benchmark::AppHost> appHost;
-  std::unique_ptr<tgfx::Recording> lastRecording;
+  std::unique_ptr<benchmark::FramePipeline> framePipeline;
+  std::unique_ptr<benchmark::SoakRunner> soakRunner;
+  NSSize soakBaseSize;
   int drawIndex;
   CVDisplayLinkRef displayLink;
 }
@@ -163,6 +168,7 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef, const CVTimeStamp*, const
 
 - (void)redraw {
   auto currentTime = tgfx::Clock::Now();
+  benchmark::MemoryTracker::BeginFrame();
   if (appHost->width() <= 0 || appHost->height() <= 0) {
     return;
   }
@@ -188,15 +194,39 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef, const CVTimeStamp*, const
   auto index = (drawIndex % numBenches);
   auto bench = benchmark::Bench::GetByIndex(index);
   bench->draw(canvas, appHost.get());
-  auto recording = context->flush();
-  std::swap(lastRecording, recording);
-  if (recording != nullptr) {
-    context->submit(std::move(recording));
+  benchmark::MemoryTracker::EndPhase(benchmark::FramePhase::Draw);
+  if (framePipeline == nullptr) {
+    framePipeline = std::make_unique<benchmark::FramePipeline>();
   }
+  auto recording = context->flush();
+  benchmark::MemoryTracker::EndPhase(benchmark::FramePhase::Flush);
+  appHost->recordGPUMemory(context->memoryUsage(), context->purgeableBytes());
+  framePipeline->submit(context, std::move(recording), currentTime);
   cglWindow->present(context);
   device->unlock();
+  framePipeline->presented(appHost.get());
+  benchmark::MemoryTracker::EndPhase(benchmark::FramePhase::Submit);
   auto drawTime = tgfx::Clock::Now() - currentTime;
   appHost->recordFrame(drawTime);
+  benchmark::MemoryTracker::EndFrame();
+  if (benchmark::SoakRunner::IsEnabled()) {
+    [self updateSoak:drawTime];
+  }
+}
+
+- (void)updateSoak:(int64_t)drawTime {
+  if (soakRunner == nullptr) {
+    soakRunner = std::make_unique<benchmark::SoakRunner>();
+    soakBaseSize = view.bounds.size;
+    drawIndex = soakRunner->benchIndex();
+  }
+  if (!soakRunner->recordFrame(appHost.get(), drawTime)) {
+    return;
+  }
+  drawIndex = soakRunner->benchIndex();
+  auto scale = static_cast<CGFloat>(soakRunner->windowScale());
+  // Resizing the window goes through windowDidResize, as it would for a user.
+  [window setContentSize:NSMakeSize(soakBaseSize.width * scale, soakBaseSize.height * scale)];
 }
 @end
 
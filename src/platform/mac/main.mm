@@ -18,8 +18,10 @@
 
 #import <Cocoa/Cocoa.h>
 #import "AppDelegate.h"
+#include "base/CommandLine.h"
 
-int main(int, const char*[]) {
+int main(int argc, const char* argv[]) {
+  benchmark::CommandLine::Apply(std::vector<std::string>(argv + 1, argv + argc));
   @autoreleasepool {
     [NSApplication sharedApplication];
     [NSApp setActivationPolicy:NSApplicationActivationPolicyRegular];
@@ -21,6 +21,8 @@
 #if WINVER >= 0x0603  // Windows 8.1
 #include <shellscalingapi.h>
 #endif
+#include "base/MemoryTracker.h"
+#include "base/SoakRunner.h"
 #include "tgfx/core/Clock.h"
 
 namespace benchmark {
@@ -227,6 +229,7 @@ void TGFXWindow::createAppHost() {
 
 void TGFXWindow::draw() {
   auto currentTime = tgfx::Clock::Now();
+  MemoryTracker::BeginFrame();
   if (!tgfxWindow) {
 #ifdef TGFX_USE_ANGLE
     tgfxWindow = tgfx::EGLWindow::MakeFrom(windowHandle);
@@ -267,18 +270,46 @@ void TGFXWindow::draw() {
   auto bench = Bench::GetByIndex(index);
   bench->draw(canvas, appHost.get());
   canvas->restore();
+  MemoryTracker::EndPhase(FramePhase::Draw);
   auto recording = context->flush();
-  std::swap(lastRecording, recording);
-  if (recording != nullptr) {
-    context->submit(std::move(recording));
-  }
+  MemoryTracker::EndPhase(FramePhase::Flush);
+  appHost->recordGPUMemory(context->memoryUsage(), context->purgeableBytes());
+  framePipeline.submit(context, std::move(recording), currentTime);
 
   auto presentStartTime = tgfx::Clock::Now();
   // Exclude the present time from the draw time to avoid blocking caused by vsync.
   tgfxWindow->present(context);
   auto presentTime = tgfx::Clock::Now() - presentStartTime;
   device->unlock();
+  framePipeline.presented(appHost.get());
+  MemoryTracker::EndPhase(FramePhase::Submit);
   auto drawTime = tgfx::Clock::Now() - currentTime - presentTime;
   appHost->recordFrame(drawTime);
+  MemoryTracker::EndFrame();
+  if (SoakRunner::IsEnabled()) {
+    updateSoak(drawTime);
+  }
+}
+
+void TGFXWindow::updateSoak(int64_t drawTime) {
+  if (soakRunner == nullptr) {
+    soakRunner = std::make_unique<SoakRunner>();
+    RECT rect;
+    GetClientRect(windowHandle, &rect);
+    soakBaseWidth = static_cast<int>(rect.right - rect.left);
+    soakBaseHeight = static_cast<int>(rect.bottom - rect.top);
+    lastDrawIndex = soakRunner->benchIndex();
+  }
+  if (!soakRunner->recordFrame(appHost.get(), drawTime)) {
+    return;
+  }
+  lastDrawIndex = soakRunner->benchIndex();
+  auto scale = soakRunner->windowScale();
+  RECT rect = {0, 0, static_cast<LONG>(static_cast<float>(soakBaseWidth) * scale),
+               static_cast<LONG>(static_cast<float>(soakBaseHeight) * scale)};
+  AdjustWindowRect(&rect, static_cast<DWORD>(GetWindowLong(windowHandle, GWL_STYLE)), FALSE);
+  // Resizing the window goes through the same path as a user resize.
+  SetWindowPos(windowHandle, nullptr, 0, 0, rect.right - rect.left, rect.bottom - rect.top,
+               SWP_NOMOVE | SWP_NOZORDER);
 }
 }  // namespace benchmark
\ No newline at end of file
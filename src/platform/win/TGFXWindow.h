@@ -28,6 +28,8 @@
 #include <memory>
 #include <string>
 #include "base/Bench.h"
+#include "base/FramePipeline.h"
+#include "base/SoakRunner.h"
 #ifdef TGFX_USE_ANGLE
 #include "tgfx/gpu/opengl/egl/EGLWindow.h"
 #else
@@ -44,7 +46,6 @@ class TGFXWindow {
 
  private:
   HWND windowHandle = nullptr;
-  std::unique_ptr<tgfx::Recording> lastRecording = nullptr;
   int lastDrawIndex = 0;
   std::shared_ptr<AppHost> appHost = nullptr;
 #ifdef TGFX_USE_ANGLE
@@ -52,6 +53,11 @@ class TGFXWindow {
 #else
   std::shared_ptr<tgfx::WGLWindow> tgfxWindow = nullptr;
 #endif
+  // Declared after tgfxWindow so that pending frames are dropped before the window is released.
+  FramePipeline framePipeline = {};
+  std::unique_ptr<SoakRunner> soakRunner = nullptr;
+  int soakBaseWidth = 0;
+  int soakBaseHeight = 0;
 
   static WNDCLASS RegisterWindowClass();
   static LRESULT CALLBACK WndProc(HWND window, UINT message, WPARAM wparam, LPARAM lparam) noexcept;
@@ -63,5 +69,6 @@ class TGFXWindow {
   float getPixelRatio();
   void createAppHost();
   void draw();
+  void updateSoak(int64_t drawTime);
 };
 }  // namespace benchmark
@@ -23,6 +23,7 @@
 #include <windows.h>
 #include <iostream>
 #include "TGFXWindow.h"
+#include "base/CommandLine.h"
 #if WINVER >= 0x0603  // Windows 8.1
 #include <shellscalingapi.h>
 #endif
@@ -36,6 +37,24 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 
 LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 
+std::vector<std::string> GetCommandLineArgs() {
+  std::vector<std::string> args;
+  int argc = 0;
+  auto argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+  if (argv == nullptr) {
+    return args;
+  }
+  // Skip the program name.
+  for (int i = 1; i < argc; ++i) {
+    auto size = WideCharToMultiByte(CP_UTF8, 0, argv[i], -1, nullptr, 0, nullptr, nullptr);
+    std::string arg(static_cast<size_t>(size > 0 ? size - 1 : 0), '\0');
+    WideCharToMultiByte(CP_UTF8, 0, argv[i], -1, arg.data(), size, nullptr, nullptr);
+    args.push_back(arg);
+  }
+  LocalFree(argv);
+  return args;
+}
+
 void ForceHighPerformanceCore() {
   // Get the current process handle
   HANDLE hProcess = GetCurrentProcess();
@@ -81,6 +100,7 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
   SetProcessDPIAware();
 #endif
   ForceHighPerformanceCore();
+  benchmark::CommandLine::Apply(GetCommandLineArgs());
 
   benchmark::TGFXWindow tgfxWindow = {};
   tgfxWindow.open();
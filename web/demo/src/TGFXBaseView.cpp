@@ -133,12 +133,11 @@ void TGFXBaseView::draw() {
     updatePerfInfo(particleBench->getPerfData());
   }
   auto recording = context->flush();
-  std::swap(lastRecording, recording);
-  if (recording != nullptr) {
-    context->submit(std::move(recording));
-  }
+  appHost->recordGPUMemory(context->memoryUsage(), context->purgeableBytes());
+  framePipeline.submit(context, std::move(recording), currentTime);
   window->present(context);
   device->unlock();
+  framePipeline.presented(appHost.get());
   auto drawTime = tgfx::Clock::Now() - currentTime;
   appHost->recordFrame(drawTime);
 }
@@ -203,6 +202,55 @@ void TGFXBaseView::setStroke(bool stroke) {
   appHost->resetFrames();
 }
 
+void TGFXBaseView::setLineJoin(int join) {
+  ParticleBench::SetLineJoin(static_cast<tgfx::LineJoin>(join));
+  appHost->resetFrames();
+}
+
+void TGFXBaseView::setLayerAlpha(float alpha) {
+  BlendBench::SetLayerAlpha(alpha);
+  appHost->resetFrames();
+}
+
+void TGFXBaseView::setClipDepth(int depth) {
+  ClipBench::SetClipDepth(depth);
+  appHost->resetFrames();
+}
+
+void TGFXBaseView::setSaveLayerParam(int layerCount, float boundsScale) {
+  SaveLayerBench::SetLayerCount(layerCount);
+  SaveLayerBench::SetLayerBoundsScale(boundsScale);
+  appHost->resetFrames();
+}
+
+void TGFXBaseView::setPaintCount(int count) {
+  PaintOrderBench::SetPaintCount(count);
+  appHost->resetFrames();
+}
+
+void TGFXBaseView::setStrokeWidth(float width) {
+  StrokeBench::SetStrokeWidth(width);
+  appHost->resetFrames();
+}
+
+void TGFXBaseView::setPipelineDepth(int depth) {
+  benchmark::FramePipeline::SetDepth(depth);
+  appHost->resetFrames();
+}
+
+void TGFXBaseView::setDeterministic(bool deterministic) {
+  benchmark::AppHost::SetDeterministic(deterministic);
+  appHost->resetFrames();
+}
+
+bool TGFXBaseView::setScene(const std::string& json) {
+  if (!SceneBench::SetSceneJSON(json)) {
+    return false;
+  }
+  appHost->resetFrames();
+  return true;
+}
+
 }  // namespace benchmark
 
 int main() {
@@ -20,7 +20,14 @@
 
 #include <emscripten/bind.h>
 #include "base/AppHost.h"
+#include "base/FramePipeline.h"
+#include "benchmark/BlendBench.h"
+#include "benchmark/ClipBench.h"
+#include "benchmark/PaintOrderBench.h"
 #include "benchmark/ParticleBench.h"
+#include "benchmark/SaveLayerBench.h"
+#include "benchmark/SceneBench.h"
+#include "benchmark/StrokeBench.h"
 #include "tgfx/gpu/opengl/webgl/WebGLWindow.h"
 namespace benchmark {
 
@@ -52,8 +59,26 @@ class TGFXBaseView {
 
   void setStroke(bool stroke);
 
+  void setLineJoin(int join);
+
+  void setLayerAlpha(float alpha);
+
+  void setClipDepth(int depth);
+
+  void setSaveLayerParam(int layerCount, float boundsScale);
+
+  void setPaintCount(int count);
+
+  void setStrokeWidth(float width);
+
+  void setPipelineDepth(int depth);
+
+  void setDeterministic(bool deterministic);
+
+  bool setScene(const std::string& json);
+
   int drawIndex = 0;
-  std::unique_ptr<tgfx::Recording> lastRecording = nullptr;
+  benchmark::FramePipeline framePipeline = {};
   std::shared_ptr<benchmark::AppHost> appHost = nullptr;
   bool showPerfDataFlag = true;
 
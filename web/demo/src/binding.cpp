@@ -35,7 +35,16 @@ EMSCRIPTEN_BINDINGS(TGFXDemo) {
       .function("updateGraphicType", &TGFXBaseView::updateGraphicType)
       .function("showPerfData", &TGFXBaseView::showPerfData)
       .function("setAntiAlias", &TGFXBaseView::setAntiAlias)
-      .function("setStroke", &TGFXBaseView::setStroke);
+      .function("setStroke", &TGFXBaseView::setStroke)
+      .function("setLineJoin", &TGFXBaseView::setLineJoin)
+      .function("setLayerAlpha", &TGFXBaseView::setLayerAlpha)
+      .function("setClipDepth", &TGFXBaseView::setClipDepth)
+      .function("setSaveLayerParam", &TGFXBaseView::setSaveLayerParam)
+      .function("setPaintCount", &TGFXBaseView::setPaintCount)
+      .function("setStrokeWidth", &TGFXBaseView::setStrokeWidth)
+      .function("setPipelineDepth", &TGFXBaseView::setPipelineDepth)
+      .function("setDeterministic", &TGFXBaseView::setDeterministic)
+      .function("setScene", &TGFXBaseView::setScene);
 
   value_object<DrawParam>("DrawParam")
       .field("startCount", &DrawParam::startCount)